@@ -624,61 +624,17 @@ std::tuple<SearchFilter, bool, bool> Console::InputAndParseSearchCommand(
 
 std::vector<Card*> Console::ProcessSearchCommand(SearchFilter& filter) const
 {
-    std::vector<Card*> result;
+    filter.onlyCollectible = true;
 
-    for (Card* card : Cards::GetInstance().GetAllCards())
+    // When search mode is adding a card to a deck, the class is fixed to
+    // the deck class and the neutral class.
+    if (m_searchMode == SearchMode::AddCardInDeck)
     {
-        if (card->gameTags.at(GameTag::COLLECTIBLE) == 0)
-        {
-            continue;
-        }
-
-        bool rarityCondition = (filter.rarity == Rarity::INVALID ||
-                                filter.rarity == card->GetRarity());
-        bool classCondition = false;
-
-        // When search mode is adding a card to a deck, the class is fixed to
-        // the deck class and the neutral class.
-        if (m_searchMode == SearchMode::AddCardInDeck)
-        {
-            classCondition = (card->GetCardClass() == m_deckClass ||
-                              card->GetCardClass() == CardClass::NEUTRAL);
-        }
-        else if (m_searchMode == SearchMode::JustSearch)
-        {
-            classCondition = (filter.playerClass == CardClass::INVALID ||
-                              filter.playerClass == card->GetCardClass());
-        }
-        bool typeCondition = (filter.cardType == CardType::INVALID ||
-                              filter.cardType == card->GetCardType());
-        bool raceCondition =
-            (filter.race == Race::INVALID || filter.race == card->GetRace());
-        bool nameCondition =
-            (filter.name.empty() ||
-             card->name.find(filter.name) != std::string::npos);
-        bool costCondition =
-            filter.costMin <= card->gameTags.at(GameTag::COST) &&
-            filter.costMax >= card->gameTags.at(GameTag::COST);
-        bool attackCondition =
-            filter.attackMin <= card->gameTags.at(GameTag::ATK) &&
-            filter.attackMax >= card->gameTags.at(GameTag::ATK);
-        bool healthCondition =
-            filter.healthMin <= card->gameTags.at(GameTag::HEALTH) &&
-            filter.healthMax >= card->gameTags.at(GameTag::HEALTH);
-        bool mechanicsCondition = (filter.gameTag == GameTag::INVALID ||
-                                   card->HasGameTag(filter.gameTag));
-        const bool isMatched =
-            AllCondIsTrue(rarityCondition, classCondition, typeCondition,
-                          raceCondition, nameCondition, costCondition,
-                          attackCondition, healthCondition, mechanicsCondition);
-
-        if (isMatched)
-        {
-            result.emplace_back(card);
-        }
+        filter.playerClass = m_deckClass;
+        filter.includeNeutral = true;
     }
 
-    return result;
+    return Cards::FindCards(filter);
 }
 
 std::vector<std::string> Console::SplitString(
@@ -6,6 +6,7 @@
 
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Commons/Macros.hpp>
+#include <Rosetta/Loaders/CardLoader.hpp>
 
 #include <clara.hpp>
 
@@ -93,21 +94,18 @@ inline void ExportFile(const std::string& projectPath, CardSet cardSet)
     std::ofstream outputFile("result.md");
     if (outputFile)
     {
-        auto cards = Cards::GetInstance().FindCardBySet(cardSet);
+        // Excludes cards that is not collectible
+        SearchFilter filter;
+        filter.cardSet = cardSet;
+        filter.onlyCollectible = true;
+
+        auto cards = Cards::GetInstance().FindCards(filter);
         if (cards.empty())
         {
             std::cerr << "Your search did not generate any hits.\n";
             exit(EXIT_SUCCESS);
         }
 
-        // Excludes cards that is not collectible
-        cards.erase(
-            std::remove_if(cards.begin(), cards.end(),
-                           [](const Card* c) {
-                               return c->gameTags.at(GameTag::COLLECTIBLE) == 0;
-                           }),
-            cards.end());
-
         // Excludes 9 hero cards from CardSet::CORE
         if (cardSet == CardSet::CORE)
         {
@@ -164,6 +162,7 @@ int main(int argc, char* argv[])
     // Parse command
     bool showHelp = false;
     bool isExportAllCard = false;
+    bool isCompileBinary = false;
     std::string cardSetName;
     std::string projectPath;
 
@@ -173,6 +172,8 @@ int main(int argc, char* argv[])
                       "Export a list of all expansion cards") |
                   clara::Opt(cardSetName, "cardSet")["-c"]["--cardset"](
                       "Export a list of specific expansion cards") |
+                  clara::Opt(isCompileBinary)["-b"]["--binary"](
+                      "Compile cards.json into binary card data") |
                   clara::Opt(projectPath, "path")["-p"]["--path"](
                       "Specify RosettaStone project path");
 
@@ -189,6 +190,23 @@ int main(int argc, char* argv[])
         exit(EXIT_SUCCESS);
     }
 
+    if (isCompileBinary)
+    {
+        std::vector<Card*> cards;
+        CardLoader::LoadFromJson(RESOURCES_DIR "cards.json", cards);
+        CardLoader::SaveToBinary(RESOURCES_DIR "cards.bin",
+                                 RESOURCES_DIR "cards.json", cards);
+
+        std::cout << "Compiled " << cards.size() << " cards into cards.bin\n";
+
+        for (Card* card : cards)
+        {
+            delete card;
+        }
+
+        exit(EXIT_SUCCESS);
+    }
+
     if (projectPath.empty())
     {
         std::cout << "You should input RosettaStone project path\n";
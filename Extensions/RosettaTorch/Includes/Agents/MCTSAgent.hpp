@@ -15,12 +15,16 @@
 #include <Agents/MCTSRunner.hpp>
 #include <MCTS/Selection/TreeNode.hpp>
 
+#include <Rosetta/Commons/Random.hpp>
+
 namespace RosettaTorch::Agents
 {
 //!
 //! \brief MCTSAgent class.
 //!
-//! This class is simple agent to run MCTS runner.
+//! This class is simple agent to run MCTS runner. The runner is kept between
+//! Think() calls, so the subtree of the game that is reached by the chosen
+//! actions is reused by the next Think() call.
 //!
 class MCTSAgent
 {
@@ -42,22 +46,37 @@ class MCTSAgent
     //! Deleted move assignment operator.
     MCTSAgent& operator=(MCTSAgent&&) noexcept = delete;
 
-    //! Process Think() related methods.
+    //! Process Think() related methods from the start of the game. The game is
+    //! dealt once from the seed of \p gameConfig, or from a random seed if it
+    //! isn't set, and the agent sees only its own side of the deal. The hidden
+    //! zones of the opponent are sampled again in each iteration.
     //! \param gameConfig The game config.
     void Think(const GameConfig& gameConfig);
 
+    //! Process Think() related methods from \p game. It runs the iterations
+    //! set in config on top of the ones that are kept from the previous calls.
+    //! The hand and secrets of the opponent in \p game are not used as they
+    //! are, but sampled again in each iteration.
+    //! \param game The started game to think from.
+    void Think(const Game& game);
+
     //! Returns action according to \p actionType and \p choices.
     //! \param actionType The type of action.
     //! \param choices The choices of action.
     //! \return The index of chosen action.
     int GetAction(ActionType actionType, ActionChoices choices);
 
+    //! Returns the node of the tree that the last Think() call searched from.
+    //! \return The node of the tree that the last Think() call searched from.
+    const MCTS::TreeNode* GetRootNode() const;
+
  private:
     MCTSConfig m_config;
     const MCTS::TreeNode* m_rootNode = nullptr;
     const MCTS::TreeNode* m_node = nullptr;
     std::unique_ptr<MCTSRunner> m_controller = nullptr;
     IAgent& m_agent;
+    Random m_random;
 };
 }  // namespace RosettaTorch::Agents
 
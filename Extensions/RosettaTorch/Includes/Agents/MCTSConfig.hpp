@@ -10,6 +10,8 @@
 #ifndef ROSETTASTONE_TORCH_AGENTS_MCTS_CONFIG_HPP
 #define ROSETTASTONE_TORCH_AGENTS_MCTS_CONFIG_HPP
 
+#include <cstddef>
+
 namespace RosettaTorch::Agents
 {
 //!
@@ -23,7 +25,8 @@ struct MCTSConfig
         : threads(1),
           iterationsPerAction(10000),
           callbackInterval(1000),
-          actionFollowTemperature(0.0)
+          actionFollowTemperature(0.0),
+          maxTreeNodes(0)
     {
         // Do nothing
     }
@@ -34,6 +37,13 @@ struct MCTSConfig
     int callbackInterval;
 
     double actionFollowTemperature;
+
+    //! The maximum number of nodes that the trees keep. When the trees grow
+    //! near it, the least visited subtrees are pruned. Note that it caps the
+    //! node count only. The board node maps and the edge blocks of the nodes
+    //! are allocated outside of it, so it doesn't bound the memory of the
+    //! search exactly. 0 means no limit.
+    std::size_t maxTreeNodes;
 };
 }  // namespace RosettaTorch::Agents
 
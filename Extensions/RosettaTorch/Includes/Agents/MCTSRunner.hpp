@@ -13,10 +13,14 @@
 #include <Agents/MCTSConfig.hpp>
 #include <MCTS/MOMCTS.hpp>
 #include <MCTS/Selection/TreeNode.hpp>
+#include <MCTS/Selection/TreePruner.hpp>
 #include <MCTS/Statistics/Statistics.hpp>
 
 #include <Rosetta/Cards/Cards.hpp>
 
+#include <condition_variable>
+#include <mutex>
+#include <optional>
 #include <thread>
 
 namespace RosettaTorch::Agents
@@ -24,7 +28,9 @@ namespace RosettaTorch::Agents
 //!
 //! \brief MCTSRunner class.
 //!
-//! This class runs multi-thread MCTS with simple statistics.
+//! This class runs multi-thread MCTS with simple statistics. The trees are
+//! kept between runs, so a run from a game that the trees have searched
+//! before continues from the node of its board.
 //!
 class MCTSRunner
 {
@@ -36,10 +42,18 @@ class MCTSRunner
     //! Destructs MCTS runner.
     ~MCTSRunner();
 
-    //! Runs MCTS as many threads as you set in config.
+    //! Runs MCTS from the start of the game of \p gameConfig.
     //! \param gameConfig The game config.
     void Run(const GameConfig& gameConfig);
 
+    //! Runs MCTS from \p root as many threads as you set in config. Each
+    //! thread runs every iteration on a copy of \p root whose hidden zones are
+    //! sampled again by Determinize(). The node of the board of \p root
+    //! becomes the root of each tree, and the other nodes are released. The
+    //! threads of the previous run are stopped first.
+    //! \param root The started game to search from.
+    void Run(const Game& root);
+
     //! Returns the statistics of MCTS runner.
     //! \return The statistics of MCTS runner.
     const MCTS::Statistics<>& GetStatistics() const;
@@ -49,6 +63,23 @@ class MCTSRunner
     //! \return The root node of the tree.
     const MCTS::TreeNode* GetRootNode(PlayerType playerType) const;
 
+    //! Returns the pool that the nodes of the trees are created from.
+    //! \return The pool that the nodes of the trees are created from.
+    const MCTS::TreeNodePool& GetNodePool() const;
+
+    //! Returns the pruner that counts the evictions of the trees.
+    //! \return The pruner that counts the evictions of the trees.
+    const MCTS::TreePruner& GetTreePruner() const;
+
+    //! Samples the zones of \p game that \p viewer can't see. The cards in
+    //! the hand of the opponent are shuffled back into its deck and the same
+    //! number of cards are redrawn. Each of its secrets is swapped with itself
+    //! or a secret in its deck that is not active. The decks of both players
+    //! are shuffled.
+    //! \param game The game to sample the hidden zones of.
+    //! \param viewer The type of player who views the game.
+    static void Determinize(Game& game, PlayerType viewer);
+
     //! Notifies threads to stop.
     void NotifyStop();
 
@@ -56,12 +87,40 @@ class MCTSRunner
     void WaitUntilStopped();
 
  private:
+    //! Waits between iterations while the trees are pruned. If the trees grow
+    //! over TREE_PRUNE_TRIGGER_RATIO of the node limit, it requests pruning
+    //! and the last thread to arrive prunes them.
+    void SyncTreePruning();
+
+    //! Leaves the worker threads that pruning waits for.
+    void LeaveTreePruning();
+
+    //! Moves the root of each tree to the board of \p game if it differs from
+    //! the board of the current root.
+    //! \param game The game to search from.
+    void ChangeRoot(const Game& game);
+
+    //! Prunes the trees and wakes up the waiting threads. It must be called
+    //! with the pruning mutex held while no other thread is iterating.
+    void PruneTrees();
+
     MCTSConfig m_config;
     std::vector<std::thread> m_threads;
 
-    MCTS::TreeNode m_p1Tree;
-    MCTS::TreeNode m_p2Tree;
+    MCTS::TreeNodePool m_nodePool;
+    MCTS::TreeNodePtr m_p1Tree;
+    MCTS::TreeNodePtr m_p2Tree;
+    std::optional<ReducedBoardView> m_p1RootView;
+    std::optional<ReducedBoardView> m_p2RootView;
     MCTS::Statistics<> m_statistics;
+    MCTS::TreePruner m_treePruner;
+
+    std::mutex m_pruneMutex;
+    std::condition_variable m_pruneCV;
+    std::atomic_bool m_pruneRequested = false;
+    int m_activeThreads = 0;
+    int m_pausedThreads = 0;
+    std::uint64_t m_pruneGeneration = 0;
 
     std::atomic_bool m_stopFlag = false;
 };
@@ -39,6 +39,16 @@ constexpr static int CREDIT_GRANULARITY = 100;
 //! other CPUs to explore other parts of the search tree.
 constexpr static int VIRTUAL_LOSS = 3;
 
+//! When the trees grow over this ratio of the node limit, they are pruned. It
+//! leaves room for the iterations that are still running when pruning is
+//! requested, so the trees stay within the limit.
+constexpr static double TREE_PRUNE_TRIGGER_RATIO = 0.9;
+
+//! When the trees are pruned, they are pruned down to this ratio of the node
+//! limit. It leaves room to grow so that pruning doesn't run after every
+//! iteration.
+constexpr static double TREE_PRUNE_TARGET_RATIO = 0.75;
+
 //! The flag indicates whether to record leading nodes.
 constexpr static bool RECORD_LEADING_NODES =
     std::is_same_v<UpdaterPolicy, TreeUpdate>;
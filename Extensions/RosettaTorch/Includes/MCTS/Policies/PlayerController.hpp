@@ -77,7 +77,8 @@ class PlayerController
     //! \return The board of the player.
     RosettaStone::Board GetPlayerBoard(Player player) const;
 
-    //! Sets the game to control player.
+    //! Sets the game to control player. The game is started unless it is
+    //! already running.
     //! \param game The game to control player.
     void SetGame(RosettaStone::Game& game);
 
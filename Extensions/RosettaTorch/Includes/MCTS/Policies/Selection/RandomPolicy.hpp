@@ -12,6 +12,8 @@
 
 #include <MCTS/Policies/Selection/ISelectionPolicy.hpp>
 
+#include <Rosetta/Commons/Random.hpp>
+
 namespace RosettaTorch::MCTS
 {
 //!
@@ -28,6 +30,9 @@ class RandomPolicy : public ISelectionPolicy
     //! \return The index of choice.
     int SelectChoice([[maybe_unused]] ActionType actionType,
                      ChoiceIterator choiceIter) override;
+
+ private:
+    Random m_random;
 };
 }  // namespace RosettaTorch::MCTS
 
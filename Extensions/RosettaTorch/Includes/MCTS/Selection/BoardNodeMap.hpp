@@ -10,10 +10,14 @@
 #ifndef ROSETTASTONE_TORCH_MCTS_BOARD_NODE_MAP_HPP
 #define ROSETTASTONE_TORCH_MCTS_BOARD_NODE_MAP_HPP
 
+#include <MCTS/Selection/TreeNodePool.hpp>
+
 #include <Rosetta/Commons/SpinLocks.hpp>
 #include <Rosetta/Views/Board.hpp>
 #include <Rosetta/Views/ReducedBoardView.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <shared_mutex>
@@ -25,38 +29,128 @@ namespace RosettaTorch::MCTS
 {
 struct TreeNode;
 
-using MapType = std::unordered_map<ReducedBoardView, std::unique_ptr<TreeNode>>;
+//!
+//! \brief BoardNodeItem struct.
+//!
+//! This struct holds the reduced board view and the node of a board. The view
+//! is stored in place because it has a fixed size, and it tells the boards
+//! that have the same hash apart.
+//!
+struct BoardNodeItem
+{
+    ReducedBoardView view;
+    TreeNodePtr node;
+};
+
+using MapType = std::unordered_multimap<std::uint64_t, BoardNodeItem>;
+
+//! The number of bits of the hash that select the shard of BoardNodeMap.
+constexpr int BOARD_NODE_MAP_SHARD_BITS = 4;
+
+//! The number of shards of BoardNodeMap.
+constexpr std::size_t NUM_BOARD_NODE_MAP_SHARDS = 1
+                                                  << BOARD_NODE_MAP_SHARD_BITS;
+
+//! The number of boards that BoardNodeMap stores before it is split into
+//! shards.
+constexpr std::size_t BOARD_NODE_MAP_SPLIT_SIZE = 64;
 
 //!
 //! \brief BoardNodeMap class.
 //!
-//! This class stores several boards that are reduced by hash function.
+//! This class stores several boards that are reduced by hash function. The
+//! boards are looked up by the hash that the game keeps incrementally, and
+//! the boards of the same hash are compared by their reduced board views, so
+//! different boards are never merged even if their hashes collide. Most tree
+//! nodes never store
+//! a board and most of the others store a few, so the map starts with a single
+//! shard that is allocated when the first board is stored. When it grows to
+//! BOARD_NODE_MAP_SPLIT_SIZE boards, it is split into shards that have their
+//! own locks, so threads that look up different boards rarely wait for each
+//! other.
 //!
 class BoardNodeMap
 {
  public:
+    //! Default constructor.
+    BoardNodeMap() = default;
+
+    //! Destructor.
+    ~BoardNodeMap();
+
+    //! Deleted copy constructor.
+    BoardNodeMap(const BoardNodeMap&) = delete;
+
+    //! Deleted move constructor.
+    BoardNodeMap(BoardNodeMap&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    BoardNodeMap& operator=(const BoardNodeMap&) = delete;
+
+    //! Deleted move assignment operator.
+    BoardNodeMap& operator=(BoardNodeMap&&) noexcept = delete;
+
     //! Creates an new node or returns an node if the board already exists.
     //! \param board The game board.
+    //! \param pool The pool to create the node from.
     //! \param newNodeCreated The flag indicates whether to create new node.
     //! \return An node that is newly created or is already existed.
-    TreeNode* GetOrCreateNode(const Board& board,
+    TreeNode* GetOrCreateNode(const Board& board, TreeNodePool& pool,
                               bool* newNodeCreated = nullptr);
 
+    //! Removes the node of the board of \p hash and \p view from the map and
+    //! passes its ownership to the caller. Note that it must not be called
+    //! while other threads access the map.
+    //! \param hash The hash of the board.
+    //! \param view The reduced board view of the board.
+    //! \return The node of the board, or nullptr if the map doesn't have it.
+    TreeNodePtr Detach(std::uint64_t hash, const ReducedBoardView& view);
+
+    //! Releases all nodes of the map. Note that it must not be called while
+    //! other threads access the map.
+    void Clear();
+
     //! Runs \p functor on each element of the map.
     //! \param functor A function to run for each element.
     template <typename Functor>
     void ForEach(Functor&& functor) const
     {
-        std::shared_lock<SharedSpinLock> lock(m_mutex);
+        const auto forEachItem = [&functor](const Shard& shard) {
+            for (const auto& kv : shard.map)
+            {
+                if (!functor(kv.second.view, kv.second.node.get()))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        };
 
-        if (!m_map)
+        const Shard* single = m_single.load(std::memory_order_acquire);
+        if (single == nullptr)
         {
             return;
         }
 
-        for (const auto& kv : *m_map)
+        if (m_shards.load(std::memory_order_acquire) == nullptr)
         {
-            if (!functor(kv.first, kv.second.get()))
+            std::shared_lock<SharedSpinLock> lock(single->mutex);
+
+            // The single shard is empty once the map is split
+            if (m_shards.load(std::memory_order_acquire) == nullptr)
+            {
+                forEachItem(*single);
+                return;
+            }
+        }
+
+        const ShardedShard* shards = m_shards.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < NUM_BOARD_NODE_MAP_SHARDS; ++i)
+        {
+            std::shared_lock<SharedSpinLock> lock(shards[i].mutex);
+
+            if (!forEachItem(shards[i]))
             {
                 return;
             }
@@ -64,12 +158,38 @@ class BoardNodeMap
     }
 
  private:
-    //! Returns the map that stores several boards.
-    //! \return The map that stores several boards.
-    MapType& GetLockedMap();
+    //! A part of the map that is guarded by its own lock.
+    struct Shard
+    {
+        mutable SharedSpinLock mutex;
+        MapType map;
+    };
+
+    //! A shard of the split map. It is aligned to the cache line so that the
+    //! locks of different shards don't share one.
+    struct alignas(64) ShardedShard : Shard
+    {
+    };
+
+    //! Finds the item of the board of \p hash and \p view in \p shard.
+    //! \param shard The shard to find the item in.
+    //! \param hash The hash of the board.
+    //! \param view The reduced board view of the board.
+    //! \return The iterator to the item, or the end of the map of the shard.
+    static MapType::iterator Find(Shard& shard, std::uint64_t hash,
+                                  const ReducedBoardView& view);
+
+    //! Returns the single shard, and allocates it if it doesn't exist.
+    //! \return The single shard.
+    Shard& GetSingleShard();
+
+    //! Moves the boards of the single shard to the new shards. Note that the
+    //! lock of the single shard must be held exclusively.
+    //! \param single The single shard.
+    void Split(Shard& single);
 
-    mutable SharedSpinLock m_mutex;
-    std::unique_ptr<MapType> m_map;
+    std::atomic<Shard*> m_single{ nullptr };
+    std::atomic<ShardedShard*> m_shards{ nullptr };
 };
 }  // namespace RosettaTorch::MCTS
 
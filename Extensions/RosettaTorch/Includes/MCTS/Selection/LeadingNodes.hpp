@@ -86,6 +86,15 @@ class LeadingNodes
         }
     }
 
+    //! Removes the leading nodes that satisfy \p predicate.
+    //! \param predicate A function that returns true for the items to remove.
+    template <typename Predicate>
+    void EraseLeadingNodes(Predicate&& predicate)
+    {
+        std::lock_guard<SharedSpinLock> lock(m_mutex);
+        EraseIf(m_items, predicate);
+    }
+
  private:
     mutable SharedSpinLock m_mutex;
     std::vector<LeadingNodesItem> m_items;
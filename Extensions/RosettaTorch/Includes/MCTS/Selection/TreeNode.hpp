@@ -12,28 +12,49 @@
 
 #include <MCTS/Selection/EdgeAddon.hpp>
 #include <MCTS/Selection/TreeNodeAddon.hpp>
+#include <MCTS/Selection/TreeNodePool.hpp>
 
 #include <Rosetta/Commons/SpinLocks.hpp>
 
-#include <functional>
-#include <memory>
+#include <array>
+#include <atomic>
 #include <tuple>
-#include <unordered_map>
 
 namespace RosettaTorch::MCTS
 {
-struct TreeNode;
+//! The number of child edges that are stored in a block of ChildNodeMap.
+constexpr int NUM_EDGES_PER_BLOCK = 8;
 
 //!
 //! \brief ChildNodeMap class.
 //!
-//! This class stores several child nodes and has shared spin lock to run in
-//! multi-thread. Note that this class is not thread safe. Do not expose it to
-//! outside!
+//! This class stores several child nodes in blocks of edges that are only
+//! appended to. Lookups scan the edges without any lock and only the creation
+//! of a child node takes the lock, so the edge addons never move once they are
+//! created. The lookups and the creation are thread safe, but Clear() and the
+//! destructor must not run while other threads access the map.
 //!
 class ChildNodeMap
 {
  public:
+    //! Default constructor.
+    ChildNodeMap() = default;
+
+    //! Destructor. It releases all child nodes.
+    ~ChildNodeMap();
+
+    //! Deleted copy constructor.
+    ChildNodeMap(const ChildNodeMap&) = delete;
+
+    //! Deleted move constructor.
+    ChildNodeMap(ChildNodeMap&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    ChildNodeMap& operator=(const ChildNodeMap&) = delete;
+
+    //! Deleted move assignment operator.
+    ChildNodeMap& operator=(ChildNodeMap&&) noexcept = delete;
+
     //! Returns the edge addon of child node.
     //! \param choice The index of child node.
     //! \return The edge addon of child node.
@@ -41,12 +62,12 @@ class ChildNodeMap
 
     //! Creates an new child node or returns a child node if it exists.
     //! \param choice The index of child node.
-    //! \param node A node of child node.
+    //! \param pool The pool to create the child node from.
     //! \return First element is the flag indicates whether to create new node.
     //! Second element is the edge addon of child node. Third element is an
     //! child node that is newly created or is already existed.
     std::tuple<bool, EdgeAddon*, TreeNode*> GetOrCreateNewNode(
-        int choice, std::unique_ptr<TreeNode> node);
+        int choice, TreeNodePool& pool);
 
     //! Creates an redirect child node or returns a child node if it exists.
     //! \param choice The index of child node.
@@ -66,20 +87,18 @@ class ChildNodeMap
     //! an child node. If child node doesn't exist, both value are nullptr.
     std::pair<const EdgeAddon*, TreeNode*> Get(int choice) const;
 
+    //! Releases all child nodes. Note that it must not be called while other
+    //! threads access the map.
+    void Clear();
+
     //! Runs \p functor on each child node (const).
     //! \param functor A function to run for each child node.
     template <typename Functor>
     void ForEach(Functor&& functor) const
     {
-        std::shared_lock<SharedSpinLock> lock(m_mapMutex);
-
-        for (const auto& kv : m_map)
-        {
-            if (!functor(kv.first, &kv.second.edgeAddon, kv.second.node.get()))
-            {
-                return;
-            }
-        }
+        ForEachEdge([&](const Edge& edge) {
+            return functor(edge.choice, &edge.edgeAddon, edge.node.get());
+        });
     }
 
     //! Runs \p functor on each child node (non-const).
@@ -87,18 +106,70 @@ class ChildNodeMap
     template <typename Functor>
     void ForEach(Functor&& functor)
     {
-        std::shared_lock<SharedSpinLock> lock(m_mapMutex);
+        ForEachEdge([&](Edge& edge) {
+            return functor(edge.choice, &edge.edgeAddon, edge.node.get());
+        });
+    }
+
+ private:
+    //!
+    //! \brief Edge struct.
+    //!
+    //! This struct contains the edge addon and the node of a child.
+    //!
+    struct Edge
+    {
+        EdgeAddon edgeAddon;
+        TreeNodePtr node;
+        int choice = -1;
+    };
+
+    //!
+    //! \brief EdgeBlock struct.
+    //!
+    //! This struct contains a fixed number of edges and links to the next block.
+    //!
+    struct EdgeBlock
+    {
+        std::array<Edge, NUM_EDGES_PER_BLOCK> edges;
+        std::atomic<EdgeBlock*> next{ nullptr };
+    };
+
+    //! Runs \p functor on each edge that is published until \p functor
+    //! returns false.
+    //! \param functor A function to run for each edge.
+    template <typename Functor>
+    void ForEachEdge(Functor&& functor) const
+    {
+        // NOTE: The count is released after the edge and its block are
+        // written, so every edge before it is safe to read.
+        const int count = m_count.load(std::memory_order_acquire);
+        EdgeBlock* block = m_head.load(std::memory_order_acquire);
 
-        for (auto& kv : m_map)
+        for (int i = 0; i < count; ++i)
         {
-            if (!functor(kv.first, &kv.second.edgeAddon, kv.second.node.get()))
+            const int idx = i % NUM_EDGES_PER_BLOCK;
+            if (i > 0 && idx == 0)
+            {
+                block = block->next.load(std::memory_order_acquire);
+            }
+
+            if (!functor(block->edges[idx]))
             {
                 return;
             }
         }
     }
 
- private:
+    //! Finds the edge of child node.
+    //! \param choice The index of child node.
+    //! \return The edge of child node, or nullptr if it doesn't exist.
+    Edge* Find(int choice) const;
+
+    //! Appends a new edge. It must be called with the lock held.
+    //! \return The edge that is appended but not published yet.
+    Edge& Append();
+
     //! Creates an new child node or returns a child node if it exists.
     //! \param choice The index of child node.
     //! \param createChildFunctor A function to run when new node creates.
@@ -109,20 +180,9 @@ class ChildNodeMap
     std::tuple<bool, EdgeAddon*, TreeNode*> GetOrCreate(
         int choice, CreateFunctor&& createChildFunctor);
 
-    //!
-    //! \brief ChildType struct.
-    //!
-    //! This struct contains self node and addon that checks consistency,
-    //! records leading node and so on.
-    //!
-    struct ChildType
-    {
-        EdgeAddon edgeAddon;
-        std::unique_ptr<TreeNode> node;
-    };
-
-    mutable SharedSpinLock m_mapMutex;
-    std::unordered_map<int, ChildType> m_map;
+    SpinLock m_mutex{};
+    std::atomic<int> m_count{ 0 };
+    std::atomic<EdgeBlock*> m_head{ nullptr };
 };
 
 //!
@@ -133,6 +193,11 @@ class ChildNodeMap
 //!
 struct TreeNode
 {
+    //! Constructs tree node that creates its children from \p _pool.
+    //! \param _pool The pool to create the children from.
+    explicit TreeNode(TreeNodePool& _pool);
+
+    TreeNodePool& pool;
     ChildNodeMap children;
     TreeNodeAddon addon;
 };
@@ -0,0 +1,127 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_TORCH_MCTS_TREE_NODE_POOL_HPP
+#define ROSETTASTONE_TORCH_MCTS_TREE_NODE_POOL_HPP
+
+#include <Rosetta/Commons/SpinLocks.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace RosettaTorch::MCTS
+{
+struct TreeNode;
+
+//!
+//! \brief TreeNodeDeleter struct.
+//!
+//! This struct returns a tree node to the pool that it was drawn from.
+//!
+struct TreeNodeDeleter
+{
+    void operator()(TreeNode* node) const;
+};
+
+using TreeNodePtr = std::unique_ptr<TreeNode, TreeNodeDeleter>;
+
+//! The number of tree nodes that TreeNodePool allocates at once.
+constexpr std::size_t TREE_NODE_POOL_CHUNK_SIZE = 256;
+
+//! The number of free lists that TreeNodePool keeps for the threads.
+constexpr std::size_t NUM_TREE_NODE_POOL_LOCAL_LISTS = 64;
+
+//! The number of free slots that a thread moves between its own free list and
+//! the shared free list of TreeNodePool at once.
+constexpr std::size_t TREE_NODE_POOL_BATCH_SIZE = 64;
+
+//!
+//! \brief TreeNodePool class.
+//!
+//! This class allocates the nodes of a tree in chunks and reuses the memory of
+//! released nodes, so the nodes of a tree are packed together and creating a
+//! node rarely calls the system allocator. It is thread safe. Each thread
+//! creates and releases the nodes through its own free list, and only moves
+//! the free slots to or from the shared free list in batches, so the threads
+//! rarely wait for each other. The memory of the chunks is freed when the pool
+//! is destroyed, so the pool must outlive all of its nodes.
+//!
+class TreeNodePool
+{
+ public:
+    //! Constructs an empty pool.
+    TreeNodePool();
+
+    //! Destructor.
+    ~TreeNodePool();
+
+    //! Deleted copy constructor.
+    TreeNodePool(const TreeNodePool&) = delete;
+
+    //! Deleted move constructor.
+    TreeNodePool(TreeNodePool&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    TreeNodePool& operator=(const TreeNodePool&) = delete;
+
+    //! Deleted move assignment operator.
+    TreeNodePool& operator=(TreeNodePool&&) noexcept = delete;
+
+    //! Creates a new tree node that draws its children from this pool.
+    //! \return A new tree node.
+    TreeNodePtr Create();
+
+    //! Destroys \p node and reuses its memory for the nodes created later.
+    //! \param node The node to release.
+    void Release(TreeNode* node);
+
+    //! Returns the number of nodes that are not released yet. It is exact only
+    //! while no other thread creates or releases nodes.
+    //! \return The number of nodes that are not released yet.
+    std::size_t GetLiveCount() const;
+
+    //! Returns the number of nodes that the pool has memory for.
+    //! \return The number of nodes that the pool has memory for.
+    std::size_t GetCapacity() const;
+
+ private:
+    union Slot;
+
+    //! The free list of the threads that map to it. It is aligned to the
+    //! cache line so that the lists of different threads don't share one.
+    struct alignas(64) LocalList
+    {
+        RosettaStone::SpinLock mutex{};
+        Slot* head = nullptr;
+        std::size_t count = 0;
+
+        // The number of nodes that are created minus the number of nodes that
+        // are released by the threads of the list.
+        std::atomic<std::ptrdiff_t> liveCount{ 0 };
+    };
+
+    //! Returns the free list of the current thread.
+    //! \return The free list of the current thread.
+    LocalList& GetLocalList();
+
+    //! Moves a batch of free slots from the shared free list to \p local, and
+    //! allocates a new chunk if the shared free list is empty. Note that the
+    //! lock of \p local must be held.
+    //! \param local The free list of the current thread.
+    void Refill(LocalList& local);
+
+    std::array<LocalList, NUM_TREE_NODE_POOL_LOCAL_LISTS> m_localLists;
+
+    mutable RosettaStone::SpinLock m_mutex{};
+    Slot* m_freeList = nullptr;
+    std::vector<std::unique_ptr<Slot[]>> m_chunks;
+};
+}  // namespace RosettaTorch::MCTS
+
+#endif  // ROSETTASTONE_TORCH_MCTS_TREE_NODE_POOL_HPP
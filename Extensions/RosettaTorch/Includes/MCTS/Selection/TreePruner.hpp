@@ -0,0 +1,73 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_TORCH_MCTS_TREE_PRUNER_HPP
+#define ROSETTASTONE_TORCH_MCTS_TREE_PRUNER_HPP
+
+#include <MCTS/Selection/TreeNode.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace RosettaTorch::MCTS
+{
+//!
+//! \brief TreePruner class.
+//!
+//! This class keeps the trees under a node limit. It collapses the least
+//! visited nodes into leaves, so their children return to the pool while the
+//! statistics of the edges that lead to them are kept. A node is visited as
+//! many times as its child edges are chosen. Pruning must run while no other
+//! thread accesses the trees. This class also counts the evictions and moves
+//! the root of a tree to a board that the tree has searched.
+//!
+class TreePruner
+{
+ public:
+    //! Prunes the trees of \p roots until \p pool has at most \p targetCount
+    //! live nodes. The roots themselves are never pruned.
+    //! \param roots The roots of the trees to prune.
+    //! \param pool The pool that the nodes of the trees are created from.
+    //! \param targetCount The number of live nodes to prune down to.
+    void Prune(const std::vector<TreeNode*>& roots, TreeNodePool& pool,
+               std::size_t targetCount);
+
+    //! Makes the node of the board of \p boardHash and \p view the root of the
+    //! tree and releases the other nodes. The board is searched in the board node maps
+    //! from the root down, so the shallowest node of the board is taken. If
+    //! the tree doesn't have the board, it is replaced by an empty root. It
+    //! must run while no other thread accesses the tree.
+    //! \param root The root of the tree.
+    //! \param pool The pool that the nodes of the tree are created from.
+    //! \param boardHash The hash of the board to make the root.
+    //! \param view The reduced board view of the board to make the root.
+    //! \return The flag indicates whether the tree has the board.
+    static bool ChangeRoot(TreeNodePtr& root, TreeNodePool& pool,
+                           std::uint64_t boardHash,
+                           const ReducedBoardView& view);
+
+    //! Returns the number of times that the trees have been pruned.
+    //! \return The number of times that the trees have been pruned.
+    std::uint64_t GetPruneCount() const;
+
+    //! Returns the number of subtrees that have been collapsed.
+    //! \return The number of subtrees that have been collapsed.
+    std::uint64_t GetEvictedSubtrees() const;
+
+    //! Returns the number of nodes that have been returned to the pool.
+    //! \return The number of nodes that have been returned to the pool.
+    std::uint64_t GetEvictedNodes() const;
+
+ private:
+    std::atomic<std::uint64_t> m_pruneCount{ 0 };
+    std::atomic<std::uint64_t> m_evictedSubtrees{ 0 };
+    std::atomic<std::uint64_t> m_evictedNodes{ 0 };
+};
+}  // namespace RosettaTorch::MCTS
+
+#endif  // ROSETTASTONE_TORCH_MCTS_TREE_PRUNER_HPP
@@ -9,9 +9,7 @@
 
 #include <Agents/MCTSAgent.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
+#include <cmath>
 
 namespace RosettaTorch::Agents
 {
@@ -22,16 +20,36 @@ MCTSAgent::MCTSAgent(const MCTSConfig& config, IAgent& agent)
 }
 
 void MCTSAgent::Think(const GameConfig& gameConfig)
+{
+    if (gameConfig.seed)
+    {
+        m_random.Seed(*gameConfig.seed);
+    }
+
+    Game game(gameConfig);
+    game.StartGame();
+
+    Think(game);
+}
+
+void MCTSAgent::Think(const Game& game)
 {
     m_agent.BeforeThink();
 
-    m_controller.reset(new MCTSRunner(m_config));
-    m_controller->Run(gameConfig);
+    if (!m_controller)
+    {
+        m_controller = std::make_unique<MCTSRunner>(m_config);
+    }
+
+    const uint64_t startIterations =
+        m_controller->GetStatistics().GetSuccededIterates();
+    m_controller->Run(game);
 
     while (true)
     {
         const uint64_t iterations =
-            m_controller->GetStatistics().GetSuccededIterates();
+            m_controller->GetStatistics().GetSuccededIterates() -
+            startIterations;
         m_agent.Think(iterations);
 
         if (iterations >= static_cast<uint64_t>(m_config.iterationsPerAction))
@@ -45,9 +63,10 @@ void MCTSAgent::Think(const GameConfig& gameConfig)
 
     m_controller->WaitUntilStopped();
 
-    m_agent.AfterThink(m_controller->GetStatistics().GetSuccededIterates());
+    m_agent.AfterThink(m_controller->GetStatistics().GetSuccededIterates() -
+                       startIterations);
 
-    m_node = m_controller->GetRootNode(gameConfig.startPlayer);
+    m_node = m_controller->GetRootNode(game.GetCurrentPlayer().playerType);
     m_rootNode = m_node;
 }
 
@@ -118,7 +137,7 @@ int MCTSAgent::GetAction(ActionType actionType, ActionChoices choices)
         item.value = accumulated;
     }
 
-    const auto v = Random::get<double>(0.0, accumulated);
+    const auto v = m_random.Get(0.0, accumulated);
     for (const auto& item : items)
     {
         if (v < item.value)
@@ -130,6 +149,11 @@ int MCTSAgent::GetAction(ActionType actionType, ActionChoices choices)
 
     // If goes here, the only possible reason is we don't have any child nodes
     // no any choice is evaluated. randomly choose one.
-    return Random::get<int>(0, choices.Size() - 1);
+    return m_random.Get<int>(0, choices.Size() - 1);
+}
+
+const MCTS::TreeNode* MCTSAgent::GetRootNode() const
+{
+    return m_rootNode;
 }
 }  // namespace RosettaTorch::Agents
\ No newline at end of file
@@ -9,9 +9,16 @@
 
 #include <Agents/MCTSRunner.hpp>
 
+#include <Rosetta/Models/Spell.hpp>
+
+#include <algorithm>
+
 namespace RosettaTorch::Agents
 {
-MCTSRunner::MCTSRunner(const MCTSConfig& config) : m_config(config)
+MCTSRunner::MCTSRunner(const MCTSConfig& config)
+    : m_config(config),
+      m_p1Tree(m_nodePool.Create()),
+      m_p2Tree(m_nodePool.Create())
 {
     // Do nothing
 }
@@ -23,20 +30,54 @@ MCTSRunner::~MCTSRunner()
 
 void MCTSRunner::Run(const GameConfig& gameConfig)
 {
+    Game root(gameConfig);
+    root.StartGame();
+
+    Run(root);
+}
+
+void MCTSRunner::Run(const Game& root)
+{
+    WaitUntilStopped();
+
     m_stopFlag = false;
 
+    ChangeRoot(root);
+
+    // Each thread derives the seeds of its games from its own generator
+    Random random = root.random;
+
+    {
+        std::lock_guard<std::mutex> lock(m_pruneMutex);
+        m_activeThreads += m_config.threads;
+    }
+
+    // The player to act can see only its own hand and secrets
+    const PlayerType viewer = root.GetCurrentPlayer().playerType;
+
     for (int i = 0; i < m_config.threads; ++i)
     {
-        m_threads.emplace_back([this, gameConfig]() {
-            MCTS::MOMCTS mcts(m_p1Tree, m_p2Tree, m_statistics);
+        m_threads.emplace_back([this, viewer, threadRoot = root.Clone(),
+                                seed = random()]() {
+            MCTS::MOMCTS mcts(*m_p1Tree, *m_p2Tree, m_statistics);
+            Random threadRandom(seed);
 
             while (!m_stopFlag.load())
             {
-                Game game(gameConfig);
-                mcts.Iterate(game);
+                const auto game = threadRoot->Clone();
+                game->random.Seed(threadRandom());
+
+                // Each iteration samples the cards that the viewer can't see
+                Determinize(*game, viewer);
+
+                mcts.Iterate(*game);
 
                 m_statistics.IterateSucceeded();
+
+                SyncTreePruning();
             }
+
+            LeaveTreePruning();
         });
     }
 }
@@ -50,14 +91,98 @@ const MCTS::TreeNode* MCTSRunner::GetRootNode(PlayerType playerType) const
 {
     if (playerType == PlayerType::PLAYER1)
     {
-        return &m_p1Tree;
+        return m_p1Tree.get();
     }
     else
     {
-        return &m_p2Tree;
+        return m_p2Tree.get();
     }
 }
 
+const MCTS::TreeNodePool& MCTSRunner::GetNodePool() const
+{
+    return m_nodePool;
+}
+
+const MCTS::TreePruner& MCTSRunner::GetTreePruner() const
+{
+    return m_treePruner;
+}
+
+void MCTSRunner::Determinize(Game& game, PlayerType viewer)
+{
+    Player& opponent = viewer == PlayerType::PLAYER1 ? game.GetPlayer2()
+                                                     : game.GetPlayer1();
+    auto& hand = opponent.GetHandZone();
+    auto& deck = opponent.GetDeckZone();
+    auto& secrets = opponent.GetSecretZone();
+
+    // Redraw each card in hand at its position, but keep The Coin
+    for (auto* entity : hand.GetAll())
+    {
+        if (entity->card->id == "GAME_005" || deck.IsFull())
+        {
+            continue;
+        }
+
+        const int zonePos = entity->GetZonePosition();
+        hand.Remove(*entity);
+        deck.Add(*entity);
+        deck.Shuffle();
+
+        Entity& newCard = deck.Remove(*deck.GetTopCard());
+        hand.Add(newCard, zonePos);
+    }
+
+    // Redraw each secret from itself and the secrets in deck that are not
+    // active, and swap it with the one that is drawn
+    for (auto* secret : secrets.GetAll())
+    {
+        const int orderOfPlay = secret->orderOfPlay;
+        secrets.Remove(*secret);
+
+        // NOTE: SecretZone::Exist() may find the removed secret in the slot
+        // that it leaves, so the active secrets are compared one by one.
+        const auto activeSecrets = secrets.GetAll();
+        const auto isActive = [&activeSecrets](const Spell& spell) {
+            return std::any_of(activeSecrets.begin(), activeSecrets.end(),
+                               [&spell](const Spell* activeSecret) {
+                                   return activeSecret->card->id ==
+                                          spell.card->id;
+                               });
+        };
+
+        std::vector<Spell*> candidates{ secret };
+        for (auto* entity : deck.GetAll())
+        {
+            auto* spell = dynamic_cast<Spell*>(entity);
+            if (spell != nullptr && spell->IsSecret() && !isActive(*spell))
+            {
+                candidates.emplace_back(spell);
+            }
+        }
+
+        Spell* newSecret = *game.random.Get(candidates);
+        if (newSecret != secret)
+        {
+            deck.Remove(*newSecret);
+            deck.Add(*secret);
+        }
+
+        if (newSecret->card->power.GetTrigger())
+        {
+            newSecret->card->power.GetTrigger()->Activate(newSecret);
+        }
+
+        secrets.Add(*newSecret);
+        newSecret->orderOfPlay = orderOfPlay;
+        newSecret->SetExhausted(true);
+    }
+
+    game.GetPlayer1().GetDeckZone().Shuffle();
+    game.GetPlayer2().GetDeckZone().Shuffle();
+}
+
 void MCTSRunner::NotifyStop()
 {
     m_stopFlag = true;
@@ -74,4 +199,79 @@ void MCTSRunner::WaitUntilStopped()
 
     m_threads.clear();
 }
+
+void MCTSRunner::SyncTreePruning()
+{
+    const auto triggerCount = static_cast<std::size_t>(
+        m_config.maxTreeNodes * MCTS::TREE_PRUNE_TRIGGER_RATIO);
+    if (!m_pruneRequested.load() &&
+        (m_config.maxTreeNodes == 0 ||
+         m_nodePool.GetLiveCount() <= triggerCount))
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_pruneMutex);
+
+    m_pruneRequested = true;
+    ++m_pausedThreads;
+
+    if (m_pausedThreads == m_activeThreads)
+    {
+        PruneTrees();
+        return;
+    }
+
+    const std::uint64_t generation = m_pruneGeneration;
+    m_pruneCV.wait(lock, [&] { return m_pruneGeneration != generation; });
+}
+
+void MCTSRunner::LeaveTreePruning()
+{
+    std::lock_guard<std::mutex> lock(m_pruneMutex);
+
+    --m_activeThreads;
+
+    // The other threads may be waiting only for this thread
+    if (m_pruneRequested.load() && m_pausedThreads == m_activeThreads)
+    {
+        PruneTrees();
+    }
+}
+
+void MCTSRunner::ChangeRoot(const Game& game)
+{
+    // NOTE: The board needs a game that it can change to create the view.
+    const auto clonedGame = game.Clone();
+
+    const auto changeRoot = [&](PlayerType playerType,
+                                MCTS::TreeNodePtr& root,
+                                std::optional<ReducedBoardView>& rootView) {
+        const Board board(*clonedGame, playerType);
+        const ReducedBoardView view = board.CreateView();
+
+        if (rootView != view)
+        {
+            MCTS::TreePruner::ChangeRoot(root, m_nodePool, board.GetHash(),
+                                         view);
+            rootView = view;
+        }
+    };
+
+    changeRoot(PlayerType::PLAYER1, m_p1Tree, m_p1RootView);
+    changeRoot(PlayerType::PLAYER2, m_p2Tree, m_p2RootView);
+}
+
+void MCTSRunner::PruneTrees()
+{
+    const auto targetCount = static_cast<std::size_t>(
+        m_config.maxTreeNodes * MCTS::TREE_PRUNE_TARGET_RATIO);
+    m_treePruner.Prune({ m_p1Tree.get(), m_p2Tree.get() }, m_nodePool,
+                       targetCount);
+
+    m_pruneRequested = false;
+    m_pausedThreads = 0;
+    ++m_pruneGeneration;
+    m_pruneCV.notify_all();
+}
 }  // namespace RosettaTorch::Agents
\ No newline at end of file
@@ -72,6 +72,11 @@ RosettaStone::Board PlayerController::GetPlayerBoard(Player player) const
 void PlayerController::SetGame(RosettaStone::Game& game)
 {
     m_game = &game;
-    m_game->StartGame();
+
+    // A game that is copied from a started game is already running
+    if (m_game->state == RosettaStone::State::INVALID)
+    {
+        m_game->StartGame();
+    }
 }
 }  // namespace RosettaTorch::MCTS
\ No newline at end of file
@@ -9,10 +9,6 @@
 
 #include <MCTS/Policies/Selection/RandomPolicy.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaTorch::MCTS
 {
 int RandomPolicy::SelectChoice([[maybe_unused]] ActionType actionType,
@@ -28,7 +24,7 @@ int RandomPolicy::SelectChoice([[maybe_unused]] ActionType actionType,
         ++choicesIdx;
     }
 
-    const auto randIdx = Random::get<std::size_t>(0, choicesIdx - 1);
+    const auto randIdx = m_random.Get<std::size_t>(0, choicesIdx - 1);
     return choices[randIdx].choice;
 }
 }  // namespace RosettaTorch::MCTS
\ No newline at end of file
@@ -9,10 +9,6 @@
 
 #include <MCTS/Policies/Simulation/RandomCutoffPolicy.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaTorch::MCTS
 {
 bool RandomCutoffPolicy::IsEnableCutoff()
@@ -21,10 +17,11 @@ bool RandomCutoffPolicy::IsEnableCutoff()
 }
 
 PlayState RandomCutoffPolicy::GetCutoffResult(
-    [[maybe_unused]] const Board& board,
-    [[maybe_unused]] StateValue& stateValue)
+    const Board& board, [[maybe_unused]] StateValue& stateValue)
 {
-    const bool win = (Random::get<int>(0, 1) == 0);
+    Random& random = board.GetCurrentPlayer().GetGame()->random;
+
+    const bool win = (random.Get(0, 1) == 0);
     if (win)
     {
         return PlayState::WON;
@@ -43,12 +40,13 @@ void RandomCutoffPolicy::StartAction(
 }
 
 int RandomCutoffPolicy::GetChoice(
-    [[maybe_unused]] const Board& board,
-    [[maybe_unused]] const ActionValidChecker& checker,
+    const Board& board, [[maybe_unused]] const ActionValidChecker& checker,
     [[maybe_unused]] ActionType actionType, const ChoiceGetter& getter)
 {
+    Random& random = board.GetCurrentPlayer().GetGame()->random;
+
     const std::size_t count = getter.Size();
-    const auto randIdx = Random::get<std::size_t>(0, count - 1);
+    const auto randIdx = random.Get<std::size_t>(0, count - 1);
     const int result = getter.Get(randIdx);
 
     return result;
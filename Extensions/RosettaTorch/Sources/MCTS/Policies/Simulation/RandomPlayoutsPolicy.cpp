@@ -9,10 +9,6 @@
 
 #include <MCTS/Policies/Simulation/RandomPlayoutsPolicy.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaTorch::MCTS
 {
 bool RandomPlayoutsPolicy::IsEnableCutoff()
@@ -35,12 +31,13 @@ void RandomPlayoutsPolicy::StartAction(
 }
 
 int RandomPlayoutsPolicy::GetChoice(
-    [[maybe_unused]] const Board& board,
-    [[maybe_unused]] const ActionValidChecker& checker,
+    const Board& board, [[maybe_unused]] const ActionValidChecker& checker,
     [[maybe_unused]] ActionType actionType, const ChoiceGetter& getter)
 {
+    Random& random = board.GetCurrentPlayer().GetGame()->random;
+
     const std::size_t count = getter.Size();
-    const auto randIdx = Random::get<std::size_t>(0, count - 1);
+    const auto randIdx = random.Get<std::size_t>(0, count - 1);
     const int result = getter.Get(randIdx);
 
     return result;
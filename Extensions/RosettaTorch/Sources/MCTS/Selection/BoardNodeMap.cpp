@@ -12,50 +12,175 @@
 
 namespace RosettaTorch::MCTS
 {
-using MapType = std::unordered_map<ReducedBoardView, std::unique_ptr<TreeNode>>;
+BoardNodeMap::~BoardNodeMap()
+{
+    Clear();
+}
 
 TreeNode* BoardNodeMap::GetOrCreateNode(const Board& board,
+                                        TreeNodePool& pool,
                                         bool* newNodeCreated)
 {
-    const auto boardView = board.CreateView();
+    const std::uint64_t hash = board.GetHash();
+    const ReducedBoardView view = board.CreateView();
+
+    const auto find = [&](Shard& shard) -> TreeNode* {
+        const auto it = Find(shard, hash, view);
+        return it != shard.map.end() ? it->second.node.get() : nullptr;
+    };
+
+    const auto create = [&](Shard& shard) {
+        if (newNodeCreated)
+        {
+            *newNodeCreated = true;
+        }
+
+        return shard.map.emplace(hash, BoardNodeItem{ view, pool.Create() })
+            ->second.node.get();
+    };
+
+    Shard& single = GetSingleShard();
 
+    if (m_shards.load(std::memory_order_acquire) == nullptr)
     {
-        std::shared_lock<SharedSpinLock> lock(m_mutex);
+        {
+            std::shared_lock<SharedSpinLock> lock(single.mutex);
 
-        if (m_map)
+            // NOTE: The map may be split before the lock is acquired.
+            if (m_shards.load(std::memory_order_acquire) == nullptr)
+            {
+                if (TreeNode* node = find(single))
+                {
+                    return node;
+                }
+            }
+        }
+
+        std::lock_guard<SharedSpinLock> lock(single.mutex);
+
+        if (m_shards.load(std::memory_order_acquire) == nullptr)
         {
-            const auto it = m_map->find(boardView);
-            if (it != m_map->end())
+            if (TreeNode* node = find(single))
+            {
+                return node;
+            }
+
+            TreeNode* node = create(single);
+            if (single.map.size() >= BOARD_NODE_MAP_SPLIT_SIZE)
             {
-                return it->second.get();
+                Split(single);
             }
+
+            return node;
         }
     }
 
+    // NOTE: The low bits of the hash select the bucket in the shard, so the
+    // shard is selected by the high bits.
+    Shard& shard = m_shards.load(std::memory_order_acquire)
+                       [hash >> (64 - BOARD_NODE_MAP_SHARD_BITS)];
+
     {
-        std::lock_guard<SharedSpinLock> lock(m_mutex);
-        auto& item = GetLockedMap()[boardView];
-        if (!item)
+        std::shared_lock<SharedSpinLock> lock(shard.mutex);
+
+        if (TreeNode* node = find(shard))
         {
-            item.reset(new TreeNode());
+            return node;
+        }
+    }
 
-            if (newNodeCreated)
-            {
-                *newNodeCreated = true;
-            }
+    std::lock_guard<SharedSpinLock> lock(shard.mutex);
+
+    if (TreeNode* node = find(shard))
+    {
+        return node;
+    }
+
+    return create(shard);
+}
+
+TreeNodePtr BoardNodeMap::Detach(std::uint64_t hash,
+                                 const ReducedBoardView& view)
+{
+    Shard* shard = m_single.load(std::memory_order_acquire);
+    if (shard == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (ShardedShard* shards = m_shards.load(std::memory_order_acquire))
+    {
+        shard = &shards[hash >> (64 - BOARD_NODE_MAP_SHARD_BITS)];
+    }
+
+    std::lock_guard<SharedSpinLock> lock(shard->mutex);
+
+    const auto it = Find(*shard, hash, view);
+    if (it == shard->map.end())
+    {
+        return nullptr;
+    }
+
+    TreeNodePtr node = std::move(it->second.node);
+    shard->map.erase(it);
+
+    return node;
+}
+
+void BoardNodeMap::Clear()
+{
+    delete[] m_shards.exchange(nullptr, std::memory_order_acq_rel);
+    delete m_single.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+MapType::iterator BoardNodeMap::Find(Shard& shard, std::uint64_t hash,
+                                     const ReducedBoardView& view)
+{
+    const auto [begin, end] = shard.map.equal_range(hash);
+    for (auto it = begin; it != end; ++it)
+    {
+        if (it->second.view == view)
+        {
+            return it;
         }
+    }
+
+    return shard.map.end();
+}
 
-        return item.get();
+BoardNodeMap::Shard& BoardNodeMap::GetSingleShard()
+{
+    Shard* single = m_single.load(std::memory_order_acquire);
+    if (single == nullptr)
+    {
+        // NOTE: Another thread may allocate the shard at the same time.
+        // The shard of the thread that loses the race is discarded.
+        auto newSingle = new Shard();
+        if (m_single.compare_exchange_strong(single, newSingle,
+                                             std::memory_order_acq_rel))
+        {
+            single = newSingle;
+        }
+        else
+        {
+            delete newSingle;
+        }
     }
+
+    return *single;
 }
 
-MapType& BoardNodeMap::GetLockedMap()
+void BoardNodeMap::Split(Shard& single)
 {
-    if (!m_map)
+    // The new shards are not visible to other threads until they are stored
+    auto shards = new ShardedShard[NUM_BOARD_NODE_MAP_SHARDS];
+    for (auto& kv : single.map)
     {
-        m_map.reset(new MapType());
+        shards[kv.first >> (64 - BOARD_NODE_MAP_SHARD_BITS)].map.emplace(
+            kv.first, std::move(kv.second));
     }
 
-    return *m_map;
+    single.map.clear();
+    m_shards.store(shards, std::memory_order_release);
 }
-}  // namespace RosettaTorch::MCTS
\ No newline at end of file
+}  // namespace RosettaTorch::MCTS
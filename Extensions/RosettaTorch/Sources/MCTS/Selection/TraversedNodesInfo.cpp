@@ -43,8 +43,8 @@ bool TraversedNodesInfo::HasCurrentNodeMadeChoice() const
 void TraversedNodesInfo::ConstructNode()
 {
     const auto& [newNodeCreated, edgeAddon, node] =
-        m_currentNode->children.GetOrCreateNewNode(
-            m_pendingChoice, std::make_unique<TreeNode>());
+        m_currentNode->children.GetOrCreateNewNode(m_pendingChoice,
+                                                   m_currentNode->pool);
 
     AddPathNode(m_currentNode, m_pendingChoice, edgeAddon, node);
 
@@ -75,16 +75,16 @@ void TraversedNodesInfo::ConstructRedirectNode(BoardNodeMap* redirectNodeMap,
     }
     else
     {
-        TreeNode* nextNode =
-            redirectNodeMap->GetOrCreateNode(board, &m_newNodeCreated);
+        TreeNode* nextNode = redirectNodeMap->GetOrCreateNode(
+            board, m_currentNode->pool, &m_newNodeCreated);
         AddPathNode(m_currentNode, m_pendingChoice, edgeAddon, nextNode);
     }
 }
 
 void TraversedNodesInfo::JumpToNode(const Board& board)
 {
-    TreeNode* nextNode =
-        m_currentNode->addon.boardNodeMap.GetOrCreateNode(board);
+    TreeNode* nextNode = m_currentNode->addon.boardNodeMap.GetOrCreateNode(
+        board, m_currentNode->pool);
     AddPathNode(m_currentNode, -1, nullptr, nextNode);
 }
 
@@ -10,71 +10,137 @@
 #include <MCTS/Selection/TreeNode.hpp>
 
 #include <cassert>
+#include <mutex>
 
 namespace RosettaTorch::MCTS
 {
+ChildNodeMap::~ChildNodeMap()
+{
+    Clear();
+}
+
 const EdgeAddon* ChildNodeMap::GetEdgeAddon(int choice) const
 {
     return Get(choice).first;
 }
 
 std::tuple<bool, EdgeAddon*, TreeNode*> ChildNodeMap::GetOrCreateNewNode(
-    int choice, std::unique_ptr<TreeNode> node)
+    int choice, TreeNodePool& pool)
 {
-    return GetOrCreate(choice,
-                       [&](ChildType& child) { child.node = std::move(node); });
+    return GetOrCreate(choice, [&](Edge& edge) { edge.node = pool.Create(); });
 }
 
 std::tuple<bool, EdgeAddon*, TreeNode*> ChildNodeMap::GetOrCreateRedirectNode(
     int choice)
 {
     return GetOrCreate(
-        choice, [](ChildType& child) { assert(child.node.get() == nullptr); });
+        choice, [](Edge& edge) { assert(edge.node.get() == nullptr); });
 }
 
 bool ChildNodeMap::HasChild(int choice) const
 {
-    std::shared_lock<SharedSpinLock> lock(m_mapMutex);
-
-    return (m_map.find(choice) != m_map.end());
+    return Find(choice) != nullptr;
 }
 
 std::pair<const EdgeAddon*, TreeNode*> ChildNodeMap::Get(int choice) const
 {
-    std::shared_lock<SharedSpinLock> lock(m_mapMutex);
-
-    const auto it = m_map.find(choice);
-    if (it == m_map.end())
+    const Edge* edge = Find(choice);
+    if (edge == nullptr)
     {
         return { nullptr, nullptr };
     }
-    else
+
+    return { &edge->edgeAddon, edge->node.get() };
+}
+
+void ChildNodeMap::Clear()
+{
+    EdgeBlock* block = m_head.load(std::memory_order_relaxed);
+    while (block != nullptr)
     {
-        return { &it->second.edgeAddon, it->second.node.get() };
+        EdgeBlock* next = block->next.load(std::memory_order_relaxed);
+        delete block;
+        block = next;
     }
+
+    m_head.store(nullptr, std::memory_order_relaxed);
+    m_count.store(0, std::memory_order_relaxed);
 }
 
-template <class CreateFunctor>
-std::tuple<bool, EdgeAddon*, TreeNode*> ChildNodeMap::GetOrCreate(
-    int choice, CreateFunctor&& createChildFunctor)
+ChildNodeMap::Edge* ChildNodeMap::Find(int choice) const
 {
+    Edge* result = nullptr;
+
+    ForEachEdge([&](Edge& edge) {
+        if (edge.choice != choice)
+        {
+            return true;
+        }
+
+        result = &edge;
+        return false;
+    });
+
+    return result;
+}
+
+ChildNodeMap::Edge& ChildNodeMap::Append()
+{
+    const int count = m_count.load(std::memory_order_relaxed);
+    const int idx = count % NUM_EDGES_PER_BLOCK;
+
+    EdgeBlock* block = m_head.load(std::memory_order_relaxed);
+    if (block == nullptr)
     {
-        std::shared_lock<SharedSpinLock> lock(m_mapMutex);
+        block = new EdgeBlock();
+        m_head.store(block, std::memory_order_release);
+        return block->edges[idx];
+    }
 
-        auto it = m_map.find(choice);
-        if (it != m_map.end())
+    for (int i = NUM_EDGES_PER_BLOCK; i <= count; i += NUM_EDGES_PER_BLOCK)
+    {
+        EdgeBlock* next = block->next.load(std::memory_order_relaxed);
+        if (next == nullptr)
         {
-            return { false, &it->second.edgeAddon, it->second.node.get() };
+            next = new EdgeBlock();
+            block->next.store(next, std::memory_order_release);
         }
+
+        block = next;
     }
 
+    return block->edges[idx];
+}
+
+template <class CreateFunctor>
+std::tuple<bool, EdgeAddon*, TreeNode*> ChildNodeMap::GetOrCreate(
+    int choice, CreateFunctor&& createChildFunctor)
+{
+    if (Edge* edge = Find(choice); edge != nullptr)
     {
-        std::lock_guard<SharedSpinLock> writeLock(m_mapMutex);
+        return { false, &edge->edgeAddon, edge->node.get() };
+    }
 
-        auto& child = m_map[choice];
-        createChildFunctor(child);
+    std::lock_guard<SpinLock> lock(m_mutex);
 
-        return { true, &child.edgeAddon, child.node.get() };
+    // Another thread may have created the child while waiting for the lock
+    if (Edge* edge = Find(choice); edge != nullptr)
+    {
+        return { false, &edge->edgeAddon, edge->node.get() };
     }
+
+    Edge& edge = Append();
+    edge.choice = choice;
+    createChildFunctor(edge);
+
+    m_count.store(m_count.load(std::memory_order_relaxed) + 1,
+                  std::memory_order_release);
+
+    return { true, &edge.edgeAddon, edge.node.get() };
+}
+
+TreeNode::TreeNode(TreeNodePool& _pool) : pool(_pool)
+{
+    // Do nothing
 }
-}  // namespace RosettaTorch::MCTS
\ No newline at end of file
+}  // namespace RosettaTorch::MCTS
@@ -0,0 +1,157 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <MCTS/Selection/TreeNode.hpp>
+#include <MCTS/Selection/TreeNodePool.hpp>
+
+#include <cassert>
+#include <mutex>
+
+namespace RosettaTorch::MCTS
+{
+//! The memory of a tree node. It links to the next free slot while the node
+//! is released.
+union TreeNodePool::Slot
+{
+    Slot* next;
+    alignas(TreeNode) unsigned char storage[sizeof(TreeNode)];
+};
+
+void TreeNodeDeleter::operator()(TreeNode* node) const
+{
+    node->pool.Release(node);
+}
+
+TreeNodePool::TreeNodePool() = default;
+
+TreeNodePool::~TreeNodePool()
+{
+    assert(GetLiveCount() == 0);
+}
+
+TreeNodePtr TreeNodePool::Create()
+{
+    LocalList& local = GetLocalList();
+    Slot* slot;
+
+    {
+        std::lock_guard<RosettaStone::SpinLock> lock(local.mutex);
+
+        if (local.head == nullptr)
+        {
+            Refill(local);
+        }
+
+        slot = local.head;
+        local.head = slot->next;
+        --local.count;
+    }
+
+    local.liveCount.fetch_add(1, std::memory_order_relaxed);
+
+    return TreeNodePtr(new (slot->storage) TreeNode(*this));
+}
+
+void TreeNodePool::Release(TreeNode* node)
+{
+    // NOTE: The destructor releases the children of the node to this pool, so
+    // it must run without holding the lock.
+    node->~TreeNode();
+
+    const auto slot = reinterpret_cast<Slot*>(node);
+    LocalList& local = GetLocalList();
+
+    {
+        std::lock_guard<RosettaStone::SpinLock> lock(local.mutex);
+
+        slot->next = local.head;
+        local.head = slot;
+        ++local.count;
+
+        // Return a batch to the shared free list, so the threads that create
+        // more nodes than they release can reuse it
+        if (local.count >= 2 * TREE_NODE_POOL_BATCH_SIZE)
+        {
+            Slot* first = local.head;
+            Slot* last = first;
+            for (std::size_t i = 1; i < TREE_NODE_POOL_BATCH_SIZE; ++i)
+            {
+                last = last->next;
+            }
+
+            local.head = last->next;
+            local.count -= TREE_NODE_POOL_BATCH_SIZE;
+
+            std::lock_guard<RosettaStone::SpinLock> sharedLock(m_mutex);
+            last->next = m_freeList;
+            m_freeList = first;
+        }
+    }
+
+    local.liveCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+std::size_t TreeNodePool::GetLiveCount() const
+{
+    std::ptrdiff_t liveCount = 0;
+    for (const auto& local : m_localLists)
+    {
+        liveCount += local.liveCount.load(std::memory_order_relaxed);
+    }
+
+    return liveCount > 0 ? static_cast<std::size_t>(liveCount) : 0;
+}
+
+std::size_t TreeNodePool::GetCapacity() const
+{
+    std::lock_guard<RosettaStone::SpinLock> lock(m_mutex);
+
+    return m_chunks.size() * TREE_NODE_POOL_CHUNK_SIZE;
+}
+
+TreeNodePool::LocalList& TreeNodePool::GetLocalList()
+{
+    static std::atomic<std::size_t> s_nextIndex{ 0 };
+    thread_local const std::size_t index =
+        s_nextIndex.fetch_add(1, std::memory_order_relaxed) %
+        NUM_TREE_NODE_POOL_LOCAL_LISTS;
+
+    return m_localLists[index];
+}
+
+void TreeNodePool::Refill(LocalList& local)
+{
+    std::lock_guard<RosettaStone::SpinLock> lock(m_mutex);
+
+    if (m_freeList == nullptr)
+    {
+        auto chunk = std::make_unique<Slot[]>(TREE_NODE_POOL_CHUNK_SIZE);
+
+        // Link the slots in reverse order to hand them out in order
+        for (std::size_t i = TREE_NODE_POOL_CHUNK_SIZE; i > 0; --i)
+        {
+            chunk[i - 1].next = local.head;
+            local.head = &chunk[i - 1];
+        }
+
+        local.count += TREE_NODE_POOL_CHUNK_SIZE;
+        m_chunks.emplace_back(std::move(chunk));
+
+        return;
+    }
+
+    for (std::size_t i = 0;
+         i < TREE_NODE_POOL_BATCH_SIZE && m_freeList != nullptr; ++i)
+    {
+        Slot* slot = m_freeList;
+        m_freeList = slot->next;
+
+        slot->next = local.head;
+        local.head = slot;
+        ++local.count;
+    }
+}
+}  // namespace RosettaTorch::MCTS
@@ -0,0 +1,210 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <MCTS/Selection/TreePruner.hpp>
+
+#include <algorithm>
+#include <queue>
+#include <unordered_set>
+
+namespace RosettaTorch::MCTS
+{
+//! Runs \p functor on \p root and every node that it owns. The nodes that
+//! redirect edges lead to are owned by the board node maps, so each node is
+//! visited once.
+template <typename Functor>
+void ForEachOwnedNode(TreeNode* root, Functor&& functor)
+{
+    std::vector<TreeNode*> stack{ root };
+
+    while (!stack.empty())
+    {
+        TreeNode* node = stack.back();
+        stack.pop_back();
+
+        functor(node);
+
+        node->children.ForEach(
+            [&](int, const EdgeAddon*, TreeNode* child) {
+                if (child != nullptr)
+                {
+                    stack.push_back(child);
+                }
+                return true;
+            });
+        node->addon.boardNodeMap.ForEach(
+            [&](const ReducedBoardView&, TreeNode* child) {
+                stack.push_back(child);
+                return true;
+            });
+    }
+}
+
+void TreePruner::Prune(const std::vector<TreeNode*>& roots,
+                       TreeNodePool& pool, std::size_t targetCount)
+{
+    struct Candidate
+    {
+        TreeNode* node;
+        std::int64_t visits;
+    };
+
+    std::vector<Candidate> candidates;
+
+    for (const auto root : roots)
+    {
+        ForEachOwnedNode(root, [&](TreeNode* node) {
+            if (node == root)
+            {
+                return;
+            }
+
+            std::int64_t visits = 0;
+            node->children.ForEach([&](int, const EdgeAddon* edgeAddon,
+                                       TreeNode*) {
+                visits += edgeAddon->GetChosenTimes();
+                return true;
+            });
+
+            bool hasBoardNodes = false;
+            node->addon.boardNodeMap.ForEach(
+                [&](const ReducedBoardView&, TreeNode*) {
+                    hasBoardNodes = true;
+                    return false;
+                });
+
+            // Leaves don't own any node to release
+            if (visits > 0 || hasBoardNodes)
+            {
+                candidates.push_back({ node, visits });
+            }
+        });
+    }
+
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const Candidate& lhs, const Candidate& rhs) {
+                         return lhs.visits < rhs.visits;
+                     });
+
+    // The nodes that are released or lose their children. The edges and nodes
+    // that the remaining nodes remember as leading nodes may be among them.
+    std::unordered_set<TreeNode*> invalidated;
+
+    const std::size_t prevCount = pool.GetLiveCount();
+
+    for (const auto& candidate : candidates)
+    {
+        if (pool.GetLiveCount() <= targetCount)
+        {
+            break;
+        }
+
+        // Skip the nodes that were released with the subtree of an ancestor
+        if (invalidated.count(candidate.node) > 0)
+        {
+            continue;
+        }
+
+        ForEachOwnedNode(candidate.node,
+                         [&](TreeNode* node) { invalidated.insert(node); });
+
+        candidate.node->children.Clear();
+        candidate.node->addon.boardNodeMap.Clear();
+
+        ++m_evictedSubtrees;
+    }
+
+    if constexpr (RECORD_LEADING_NODES)
+    {
+        for (const auto root : roots)
+        {
+            ForEachOwnedNode(root, [&](TreeNode* node) {
+                node->addon.leadingNodes.EraseLeadingNodes(
+                    [&](const LeadingNodesItem& item) {
+                        return invalidated.count(item.node) > 0;
+                    });
+            });
+        }
+    }
+
+    ++m_pruneCount;
+    m_evictedNodes += prevCount - pool.GetLiveCount();
+}
+
+bool TreePruner::ChangeRoot(TreeNodePtr& root, TreeNodePool& pool,
+                            std::uint64_t boardHash,
+                            const ReducedBoardView& view)
+{
+    TreeNodePtr newRoot;
+    std::queue<TreeNode*> queue;
+    queue.push(root.get());
+
+    while (!queue.empty())
+    {
+        TreeNode* node = queue.front();
+        queue.pop();
+
+        newRoot = node->addon.boardNodeMap.Detach(boardHash, view);
+        if (newRoot)
+        {
+            break;
+        }
+
+        node->children.ForEach(
+            [&](int, const EdgeAddon*, TreeNode* child) {
+                if (child != nullptr)
+                {
+                    queue.push(child);
+                }
+                return true;
+            });
+        node->addon.boardNodeMap.ForEach(
+            [&](const ReducedBoardView&, TreeNode* child) {
+                queue.push(child);
+                return true;
+            });
+    }
+
+    if (!newRoot)
+    {
+        root = pool.Create();
+        return false;
+    }
+
+    // Releases the old root and all nodes that are not under the new root
+    root = std::move(newRoot);
+
+    if constexpr (RECORD_LEADING_NODES)
+    {
+        std::unordered_set<TreeNode*> kept;
+        ForEachOwnedNode(root.get(), [&](TreeNode* node) { kept.insert(node); });
+
+        ForEachOwnedNode(root.get(), [&](TreeNode* node) {
+            node->addon.leadingNodes.EraseLeadingNodes(
+                [&](const LeadingNodesItem& item) {
+                    return kept.count(item.node) == 0;
+                });
+        });
+    }
+
+    return true;
+}
+
+std::uint64_t TreePruner::GetPruneCount() const
+{
+    return m_pruneCount.load();
+}
+
+std::uint64_t TreePruner::GetEvictedSubtrees() const
+{
+    return m_evictedSubtrees.load();
+}
+
+std::uint64_t TreePruner::GetEvictedNodes() const
+{
+    return m_evictedNodes.load();
+}
+}  // namespace RosettaTorch::MCTS
@@ -7,16 +7,63 @@
 // It is based on peter1591's hearthstone-ai repository.
 // References: https://github.com/peter1591/hearthstone-ai
 
+#include "gtest/gtest.h"
+
+#include <Agents/IAgent.hpp>
+#include <Agents/MCTSAgent.hpp>
 #include <Agents/MCTSConfig.hpp>
 #include <Agents/MCTSRunner.hpp>
+#include <MCTS/Selection/BoardNodeMap.hpp>
+#include <MCTS/Selection/TreeNode.hpp>
+#include <MCTS/Selection/TreePruner.hpp>
+
+#include <Rosetta/Actions/Draw.hpp>
+#include <Rosetta/Tasks/PlayerTasks/EndTurnTask.hpp>
+#include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <set>
+#include <string>
 #include <sstream>
+#include <thread>
 
 using namespace RosettaTorch;
 
 static Agents::MCTSConfig g_config;
 
+GameConfig GenerateGameConfig()
+{
+    GameConfig gameConfig;
+    gameConfig.player1Class = CardClass::PRIEST;
+    gameConfig.player2Class = CardClass::MAGE;
+    gameConfig.startPlayer = PlayerType::PLAYER1;
+    gameConfig.doShuffle = false;
+    gameConfig.doFillDecks = false;
+    gameConfig.skipMulligan = true;
+    gameConfig.autoRun = true;
+
+    std::array<std::string, START_DECK_SIZE> deck = {
+        "CS2_106", "CS2_105", "CS1_112", "CS1_112",  // 1
+        "CS1_113", "CS1_113", "CS1_130", "CS1_130",  // 2
+        "CS2_007", "CS2_007", "CS2_022", "CS2_022",  // 3
+        "CS2_023", "CS2_023", "CS2_024", "CS2_024",  // 4
+        "CS2_025", "CS2_025", "CS2_026", "CS2_026",  // 5
+        "CS2_027", "CS2_027", "CS2_029", "CS2_029",  // 6
+        "CS2_032", "CS2_032", "CS2_033", "CS2_033",  // 7
+        "CS2_037", "CS2_037"
+    };
+
+    for (size_t j = 0; j < START_DECK_SIZE; ++j)
+    {
+        gameConfig.player1Deck[j] = *Cards::FindCardByID(deck[j]);
+        gameConfig.player2Deck[j] = *Cards::FindCardByID(deck[j]);
+    }
+
+    return gameConfig;
+}
+
 void Run(const Agents::MCTSConfig& config, Agents::MCTSRunner* controller,
          int secs)
 {
@@ -51,32 +98,7 @@ void Run(const Agents::MCTSConfig& config, Agents::MCTSRunner* controller,
 
     const auto startIter = controller->GetStatistics().GetSuccededIterates();
 
-    GameConfig gameConfig;
-    gameConfig.player1Class = CardClass::PRIEST;
-    gameConfig.player2Class = CardClass::MAGE;
-    gameConfig.startPlayer = PlayerType::PLAYER1;
-    gameConfig.doShuffle = false;
-    gameConfig.doFillDecks = false;
-    gameConfig.skipMulligan = true;
-    gameConfig.autoRun = true;
-
-    std::array<std::string, START_DECK_SIZE> deck = {
-        "CS2_106", "CS2_105", "CS1_112", "CS1_112",  // 1
-        "CS1_113", "CS1_113", "CS1_130", "CS1_130",  // 2
-        "CS2_007", "CS2_007", "CS2_022", "CS2_022",  // 3
-        "CS2_023", "CS2_023", "CS2_024", "CS2_024",  // 4
-        "CS2_025", "CS2_025", "CS2_026", "CS2_026",  // 5
-        "CS2_027", "CS2_027", "CS2_029", "CS2_029",  // 6
-        "CS2_032", "CS2_032", "CS2_033", "CS2_033",  // 7
-        "CS2_037", "CS2_037"
-    };
-
-    for (size_t j = 0; j < START_DECK_SIZE; ++j)
-    {
-        gameConfig.player1Deck[j] = *Cards::FindCardByID(deck[j]);
-        gameConfig.player2Deck[j] = *Cards::FindCardByID(deck[j]);
-    }
-
+    const GameConfig gameConfig = GenerateGameConfig();
     controller->Run(gameConfig);
 
     while (true)
@@ -128,24 +150,545 @@ void CheckRun(const std::string& cmdLine, Agents::MCTSRunner* controller)
     }
 }
 
-int main()
+//!
+//! \brief TestAgent class.
+//!
+//! This class records the number of iterations that MCTSAgent has run.
+//!
+class TestAgent : public Agents::IAgent
 {
-    Cards::GetInstance();
+ public:
+    void BeforeThink() override
+    {
+        // Do nothing
+    }
+
+    void Think(uint64_t) override
+    {
+        // Do nothing
+    }
+
+    void AfterThink(uint64_t iteration) override
+    {
+        iterations = iteration;
+    }
 
-    Agents::MCTSRunner controller(g_config);
+    uint64_t iterations = 0;
+};
 
-    while (std::cin)
+//!
+//! \brief TestActionParams class.
+//!
+//! This class chooses the actions of the game by MCTSAgent. The main action
+//! to end the turn is never chosen, so the game stays in the current turn.
+//!
+class TestActionParams : public ActionParams
+{
+ public:
+    explicit TestActionParams(Agents::MCTSAgent& agent) : m_agent(agent)
     {
-        std::string cmdline;
-        std::cout << "Command: ";
-        std::getline(std::cin, cmdline);
+        // Do nothing
+    }
 
-        if (cmdline == "q" || cmdline == "quit")
+    std::size_t GetNumber(ActionType actionType,
+                          ActionChoices& choices) override
+    {
+        if (actionType == ActionType::MAIN_ACTION)
         {
-            std::cout << "Good bye!" << std::endl;
-            break;
+            std::vector<std::size_t> mainOps;
+            for (int i = 0; i < GetChecker().GetMainActionsCount(); ++i)
+            {
+                if (GetChecker().GetMainActions()[i] != MainOpType::END_TURN)
+                {
+                    mainOps.emplace_back(i);
+                }
+            }
+
+            return m_agent.GetAction(actionType, ActionChoices(mainOps));
+        }
+
+        if (choices.Size() == 1)
+        {
+            return choices.Get(0);
+        }
+
+        return m_agent.GetAction(actionType, choices);
+    }
+
+ private:
+    Agents::MCTSAgent& m_agent;
+};
+
+std::int64_t GetVisits(const MCTS::TreeNode* node)
+{
+    std::int64_t visits = 0;
+    node->children.ForEach(
+        [&](int, const MCTS::EdgeAddon* edgeAddon, const MCTS::TreeNode*) {
+            visits += edgeAddon->GetChosenTimes();
+            return true;
+        });
+
+    return visits;
+}
+
+TEST(BoardNodeMap, Split)
+{
+    constexpr int NUM_THREADS = 4;
+    constexpr int NUM_DAMAGES = 16;
+    constexpr int NUM_BOARDS = NUM_DAMAGES * NUM_DAMAGES;
+    static_assert(NUM_BOARDS > MCTS::BOARD_NODE_MAP_SPLIT_SIZE,
+                  "The map must be split in the test.");
+
+    MCTS::TreeNodePool pool;
+    MCTS::BoardNodeMap map;
+
+    Game root(GenerateGameConfig());
+    root.StartGame();
+
+    // The threads store the boards while the map is split
+    std::vector<std::vector<MCTS::TreeNode*>> nodes(
+        NUM_THREADS, std::vector<MCTS::TreeNode*>(NUM_BOARDS, nullptr));
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < NUM_THREADS; ++t)
+    {
+        threads.emplace_back([&, t, game = root.Clone()]() {
+            for (int i = 0; i < NUM_BOARDS; ++i)
+            {
+                // Each thread visits the boards in a different order
+                const int board = (i * (2 * t + 1)) % NUM_BOARDS;
+                game->GetPlayer1().GetHero()->SetDamage(board / NUM_DAMAGES);
+                game->GetPlayer2().GetHero()->SetDamage(board % NUM_DAMAGES);
+
+                nodes[t][board] = map.GetOrCreateNode(
+                    Board(*game, PlayerType::PLAYER1), pool);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::set<MCTS::TreeNode*> distinctNodes;
+    for (int i = 0; i < NUM_BOARDS; ++i)
+    {
+        EXPECT_NE(nodes[0][i], nullptr);
+        for (int t = 1; t < NUM_THREADS; ++t)
+        {
+            EXPECT_EQ(nodes[t][i], nodes[0][i]);
         }
 
-        CheckRun(cmdline, &controller);
+        distinctNodes.emplace(nodes[0][i]);
     }
+    EXPECT_EQ(distinctNodes.size(), static_cast<std::size_t>(NUM_BOARDS));
+    EXPECT_EQ(pool.GetLiveCount(), static_cast<std::size_t>(NUM_BOARDS));
+
+    int numItems = 0;
+    map.ForEach([&](const ReducedBoardView&, MCTS::TreeNode* node) {
+        EXPECT_EQ(distinctNodes.count(node), 1u);
+        ++numItems;
+        return true;
+    });
+    EXPECT_EQ(numItems, NUM_BOARDS);
+
+    map.Clear();
+    EXPECT_EQ(pool.GetLiveCount(), 0u);
+}
+
+TEST(BoardNodeMap, Transposition)
+{
+    MCTS::TreeNodePool pool;
+    MCTS::BoardNodeMap map;
+
+    Game game(GenerateGameConfig());
+    game.StartGame();
+    const auto transposedGame = game.Clone();
+    const auto otherGame = game.Clone();
+
+    // The transposed board differs only in a game tag that the view can't see
+    Hero* hero = transposedGame->GetPlayer1().GetHero();
+    hero->SetGameTag(GameTag::ENTITY_ID,
+                     hero->GetGameTag(GameTag::ENTITY_ID) + 100);
+    otherGame->GetPlayer2().GetHero()->SetDamage(1);
+
+    const Board board(game, PlayerType::PLAYER1);
+    const Board transposedBoard(*transposedGame, PlayerType::PLAYER1);
+    const Board otherBoard(*otherGame, PlayerType::PLAYER1);
+    EXPECT_EQ(transposedBoard.GetHash(), board.GetHash());
+
+    MCTS::TreeNode* node = map.GetOrCreateNode(board, pool);
+    EXPECT_EQ(map.GetOrCreateNode(transposedBoard, pool), node);
+    EXPECT_NE(map.GetOrCreateNode(otherBoard, pool), node);
+    EXPECT_EQ(pool.GetLiveCount(), 2u);
+
+    // The node is found only by both the hash and the view of its board
+    EXPECT_EQ(map.Detach(board.GetHash(), otherBoard.CreateView()), nullptr);
+    EXPECT_EQ(map.Detach(board.GetHash(), board.CreateView()).get(), node);
+    EXPECT_EQ(pool.GetLiveCount(), 1u);
+}
+
+TEST(ChildNodeMap, GetOrCreateNewNode)
+{
+    constexpr int NUM_THREADS = 8;
+    constexpr int NUM_ITERATIONS = 2000;
+    constexpr int NUM_CHOICES = 40;
+
+    MCTS::TreeNodePool pool;
+    {
+        MCTS::TreeNodePtr root = pool.Create();
+        std::vector<std::thread> threads;
+
+        // The threads create the same children while others look them up
+        for (int t = 0; t < NUM_THREADS; ++t)
+        {
+            threads.emplace_back([&, t]() {
+                for (int i = 0; i < NUM_ITERATIONS; ++i)
+                {
+                    const int choice = (i * 7 + t) % NUM_CHOICES;
+                    auto [created, edgeAddon, node] =
+                        root->children.GetOrCreateNewNode(choice, pool);
+                    edgeAddon->AddChosenTimes(1);
+                    node->children.GetOrCreateNewNode(i % 5, pool);
+
+                    EXPECT_EQ(root->children.Get(choice).second, node);
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        int numChildren = 0;
+        std::int64_t chosenTimes = 0;
+        root->children.ForEach(
+            [&](int, const MCTS::EdgeAddon* edgeAddon, MCTS::TreeNode*) {
+                ++numChildren;
+                chosenTimes += edgeAddon->GetChosenTimes();
+                return true;
+            });
+
+        EXPECT_EQ(numChildren, NUM_CHOICES);
+        EXPECT_EQ(chosenTimes, NUM_THREADS * NUM_ITERATIONS);
+        EXPECT_EQ(pool.GetLiveCount(),
+                  static_cast<std::size_t>(1 + NUM_CHOICES * 6));
+    }
+
+    EXPECT_EQ(pool.GetLiveCount(), 0u);
+}
+
+TEST(TreeNodePool, CreateAndRelease)
+{
+    constexpr int NUM_THREADS = 4;
+    constexpr int NUM_ROUNDS = 20;
+    constexpr int NUM_NODES = 1000;
+
+    MCTS::TreeNodePool pool;
+    std::vector<std::vector<MCTS::TreeNodePtr>> nodes(NUM_THREADS);
+
+    for (int round = 0; round < NUM_ROUNDS; ++round)
+    {
+        std::vector<std::vector<MCTS::TreeNodePtr>> prevNodes(NUM_THREADS);
+        for (int t = 0; t < NUM_THREADS; ++t)
+        {
+            prevNodes[t] = std::move(nodes[(t + 1) % NUM_THREADS]);
+            nodes[(t + 1) % NUM_THREADS].clear();
+        }
+
+        std::vector<std::thread> threads;
+
+        // Each thread releases the nodes that the next thread created in the
+        // previous round, and creates new ones
+        for (int t = 0; t < NUM_THREADS; ++t)
+        {
+            threads.emplace_back([&, t]() {
+                prevNodes[t].clear();
+
+                for (int i = 0; i < NUM_NODES; ++i)
+                {
+                    nodes[t].emplace_back(pool.Create());
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(pool.GetLiveCount(),
+                  static_cast<std::size_t>(NUM_THREADS * NUM_NODES));
+    }
+
+    // The released memory is reused by the other threads
+    EXPECT_LE(pool.GetCapacity(),
+              static_cast<std::size_t>(3 * NUM_THREADS * NUM_NODES));
+
+    nodes.clear();
+    EXPECT_EQ(pool.GetLiveCount(), 0u);
+}
+
+TEST(MCTSRunner, MaxTreeNodes)
+{
+    Agents::MCTSConfig config;
+    config.threads = 3;
+    config.maxTreeNodes = 2000;
+
+    Agents::MCTSRunner runner(config);
+    runner.Run(GenerateGameConfig());
+
+    // Run until the trees are pruned a few times
+    const auto runUntil =
+        std::chrono::steady_clock::now() + std::chrono::seconds(60);
+    std::size_t maxLiveCount = 0;
+
+    while (runner.GetTreePruner().GetPruneCount() < 3 &&
+           std::chrono::steady_clock::now() < runUntil)
+    {
+        maxLiveCount =
+            std::max(maxLiveCount, runner.GetNodePool().GetLiveCount());
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    runner.WaitUntilStopped();
+    maxLiveCount = std::max(maxLiveCount, runner.GetNodePool().GetLiveCount());
+
+    EXPECT_LE(maxLiveCount, config.maxTreeNodes);
+    EXPECT_GE(runner.GetTreePruner().GetPruneCount(), 3u);
+    EXPECT_GT(runner.GetTreePruner().GetEvictedSubtrees(), 0u);
+    EXPECT_GT(runner.GetTreePruner().GetEvictedNodes(), 0u);
+}
+
+TEST(MCTSRunner, Determinize)
+{
+    Game root(GenerateGameConfig());
+    root.StartGame();
+
+    Player& opponent = root.GetPlayer2();
+    auto& secrets = opponent.GetSecretZone();
+    auto& deck = opponent.GetDeckZone();
+
+    Entity* secret = Entity::GetFromCard(
+        opponent, Cards::GetInstance().FindCardByName("Counterspell"),
+        std::nullopt, &secrets);
+    secrets.Add(*secret);
+
+    for (const auto& name : { "Ice Barrier", "Mirror Entity" })
+    {
+        Entity* entity = Entity::GetFromCard(
+            opponent, Cards::GetInstance().FindCardByName(name), std::nullopt,
+            &deck);
+        deck.Add(*entity);
+    }
+
+    const auto getCardIDs = [](auto& zone) {
+        std::vector<std::string> cardIDs;
+        for (auto* entity : zone.GetAll())
+        {
+            cardIDs.emplace_back(entity->card->id);
+        }
+
+        return cardIDs;
+    };
+
+    const auto viewerHand = getCardIDs(root.GetPlayer1().GetHandZone());
+    const auto opponentHand = getCardIDs(opponent.GetHandZone());
+    const int deckCount = deck.GetCount();
+
+    std::set<std::vector<std::string>> hands;
+    std::set<std::vector<std::string>> secretSets;
+
+    for (int i = 0; i < 20; ++i)
+    {
+        const auto game = root.Clone();
+        game->random.Seed(i);
+        Agents::MCTSRunner::Determinize(*game, PlayerType::PLAYER1);
+
+        // The viewer's hand and the number of hidden cards are kept
+        EXPECT_EQ(getCardIDs(game->GetPlayer1().GetHandZone()), viewerHand);
+        EXPECT_EQ(game->GetPlayer2().GetDeckZone().GetCount(), deckCount);
+
+        const auto hand = getCardIDs(game->GetPlayer2().GetHandZone());
+        EXPECT_EQ(hand.size(), opponentHand.size());
+        EXPECT_EQ(hand.back(), "GAME_005");
+
+        const auto secretIDs = getCardIDs(game->GetPlayer2().GetSecretZone());
+        EXPECT_EQ(secretIDs.size(), 1u);
+
+        hands.emplace(hand);
+        secretSets.emplace(secretIDs);
+    }
+
+    // The hidden zones differ across iterations
+    EXPECT_GT(hands.size(), 1u);
+    EXPECT_GT(secretSets.size(), 1u);
+}
+
+TEST(MCTSRunner, DeterminizePlayedSecret)
+{
+    Game root(GenerateGameConfig());
+    root.StartGame();
+    root.Process(root.GetPlayer1(), PlayerTasks::EndTurnTask());
+
+    // The opponent plays a secret and has no other secret in its deck
+    Player& opponent = root.GetPlayer2();
+    opponent.SetTotalMana(10);
+    opponent.SetUsedMana(0);
+
+    Entity* card =
+        Generic::DrawCard(opponent, Cards::FindCardByName("Counterspell"));
+    root.Process(opponent, PlayerTasks::PlayCardTask::Spell(card));
+    EXPECT_EQ(opponent.GetSecretZone().GetCount(), 1);
+
+    const auto getSecret = [](Game& game) {
+        auto& secrets = game.GetPlayer2().GetSecretZone();
+        EXPECT_EQ(secrets.GetCount(), 1);
+        EXPECT_NE(secrets[0]->activatedTrigger, nullptr);
+        return secrets[0]->card->name;
+    };
+
+    for (int i = 0; i < 20; ++i)
+    {
+        const auto game = root.Clone();
+        game->random.Seed(i);
+        Agents::MCTSRunner::Determinize(*game, PlayerType::PLAYER1);
+
+        // The played secret is the only candidate, so it is kept
+        EXPECT_EQ(getSecret(*game), "Counterspell");
+    }
+
+    // The only other secret may be redrawn into the hand
+    Entity* entity = Entity::GetFromCard(
+        opponent, Cards::FindCardByName("Snipe"), std::nullopt,
+        &opponent.GetDeckZone());
+    opponent.GetDeckZone().Add(*entity);
+
+    std::set<std::string> secretNames;
+    for (int i = 0; i < 50; ++i)
+    {
+        const auto game = root.Clone();
+        game->random.Seed(i);
+        Agents::MCTSRunner::Determinize(*game, PlayerType::PLAYER1);
+
+        secretNames.emplace(getSecret(*game));
+    }
+
+    EXPECT_EQ(secretNames,
+              (std::set<std::string>{ "Counterspell", "Snipe" }));
+}
+
+TEST(TreePruner, ChangeRoot)
+{
+    MCTS::TreeNodePool pool;
+    MCTS::TreeNodePtr root = pool.Create();
+
+    Game game(GenerateGameConfig());
+    game.StartGame();
+
+    // The board is stored under the first child and has a visited child
+    auto [created, edgeAddon, child] =
+        root->children.GetOrCreateNewNode(0, pool);
+    EXPECT_TRUE(created);
+    edgeAddon->AddChosenTimes(3);
+
+    game.GetPlayer2().GetHero()->SetDamage(1);
+    const Board board(game, PlayerType::PLAYER1);
+    MCTS::TreeNode* node =
+        child->addon.boardNodeMap.GetOrCreateNode(board, pool);
+    const std::uint64_t hash = board.GetHash();
+    const ReducedBoardView view = board.CreateView();
+
+    auto grandChild = node->children.GetOrCreateNewNode(2, pool);
+    std::get<1>(grandChild)->AddChosenTimes(5);
+
+    // The other subtree is released when the root changes
+    auto sibling = root->children.GetOrCreateNewNode(1, pool);
+    std::get<2>(sibling)->children.GetOrCreateNewNode(0, pool);
+    EXPECT_EQ(pool.GetLiveCount(), 6u);
+
+    // The subtree of the board is kept with its visit counts
+    EXPECT_TRUE(MCTS::TreePruner::ChangeRoot(root, pool, hash, view));
+    EXPECT_EQ(root.get(), node);
+    EXPECT_EQ(pool.GetLiveCount(), 2u);
+    EXPECT_TRUE(root->children.HasChild(2));
+    EXPECT_EQ(root->children.GetEdgeAddon(2)->GetChosenTimes(), 5);
+    EXPECT_EQ(GetVisits(root.get()), 5);
+
+    // The tree that doesn't have the board is replaced by a fresh root
+    game.GetPlayer2().GetHero()->SetDamage(2);
+    EXPECT_FALSE(MCTS::TreePruner::ChangeRoot(root, pool, board.GetHash(),
+                                              board.CreateView()));
+    EXPECT_NE(root.get(), nullptr);
+    EXPECT_FALSE(root->children.HasChild(2));
+    EXPECT_EQ(GetVisits(root.get()), 0);
+    EXPECT_EQ(pool.GetLiveCount(), 1u);
+}
+
+TEST(MCTSAgent, WarmStart)
+{
+    Agents::MCTSConfig config;
+    config.threads = 1;
+    config.iterationsPerAction = 300;
+    config.callbackInterval = 1;
+
+    TestAgent testAgent;
+    Agents::MCTSAgent agent(config, testAgent);
+
+    Game game(GenerateGameConfig());
+    game.StartGame();
+
+    // The player can play the cards in hand as well as end the turn
+    game.GetPlayer1().SetTotalMana(10);
+    game.GetPlayer1().SetUsedMana(0);
+
+    agent.Think(game);
+    EXPECT_GE(testAgent.iterations, 300u);
+    EXPECT_GT(GetVisits(agent.GetRootNode()), 0);
+
+    // Play the action that the agent chooses and think again
+    TestActionParams params(agent);
+    params.Initialize(game);
+    EXPECT_EQ(game.PerformAction(params), PlayState::PLAYING);
+    EXPECT_EQ(game.GetCurrentPlayer().playerType, PlayerType::PLAYER1);
+
+    agent.Think(game);
+    EXPECT_GE(testAgent.iterations, 300u);
+
+    // The root keeps the visits of the previous call
+    EXPECT_GT(GetVisits(agent.GetRootNode()),
+              static_cast<std::int64_t>(testAgent.iterations));
+}
+
+int main(int argc, char* argv[])
+{
+    Cards::GetInstance();
+
+    // Runs MCTS with the commands from standard input
+    if (argc > 1 && std::string(argv[1]) == "--interactive")
+    {
+        Agents::MCTSRunner controller(g_config);
+
+        while (std::cin)
+        {
+            std::string cmdline;
+            std::cout << "Command: ";
+            std::getline(std::cin, cmdline);
+
+            if (cmdline == "q" || cmdline == "quit")
+            {
+                std::cout << "Good bye!" << std::endl;
+                break;
+            }
+
+            CheckRun(cmdline, &controller);
+        }
+
+        return 0;
+    }
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
 }
@@ -42,7 +42,7 @@ class ActionValidGetter
                               ? m_game.GetPlayer1().GetFieldZone()
                               : m_game.GetPlayer2().GetFieldZone();
 
-        for (auto& minion : fieldZone.GetAll())
+        for (auto& minion : fieldZone.GetAlive())
         {
             functor(minion);
         }
@@ -55,7 +55,7 @@ class ActionValidGetter
     {
         auto& handZone = m_game.GetCurrentPlayer().GetHandZone();
 
-        for (auto& card : handZone.GetAll())
+        for (auto& card : handZone.GetAlive())
         {
             if (!IsPlayable(card))
             {
@@ -76,7 +76,7 @@ class ActionValidGetter
     {
         auto& fieldZone = m_game.GetCurrentPlayer().GetFieldZone();
 
-        for (auto& minion : fieldZone.GetAll())
+        for (auto& minion : fieldZone.GetAlive())
         {
             if (!minion->CanAttack())
             {
@@ -87,7 +87,7 @@ class Card
     virtual void ShowInfo() const;
 
     std::string id;
-    int dbfID;
+    int dbfID = 0;
     std::string name;
     std::string text;
 
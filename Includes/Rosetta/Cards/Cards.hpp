@@ -9,6 +9,11 @@
 
 #include <Rosetta/Cards/Card.hpp>
 
+#include <limits>
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
 namespace RosettaStone
@@ -17,19 +22,26 @@ namespace RosettaStone
 //! \brief Search filter structure.
 //!
 //! This structure stores the filter value for searching the card.
+//! The value INVALID (ALL for the card set) matches any card.
 //!
 struct SearchFilter
 {
     Rarity rarity = Rarity::INVALID;
     CardClass playerClass = CardClass::INVALID;
+    CardSet cardSet = CardSet::ALL;
     CardType cardType = CardType::INVALID;
     Race race = Race::INVALID;
     GameTag gameTag = GameTag::INVALID;
 
+    //! Matches neutral cards in addition to the cards of \p playerClass.
+    bool includeNeutral = false;
+    //! Matches collectible cards only.
+    bool onlyCollectible = false;
+
     std::string name;
-    int costMin = 0, costMax = 0;
-    int attackMin = 0, attackMax = 0;
-    int healthMin = 0, healthMax = 0;
+    int costMin = 0, costMax = std::numeric_limits<int>::max();
+    int attackMin = 0, attackMax = std::numeric_limits<int>::max();
+    int healthMin = 0, healthMax = std::numeric_limits<int>::max();
 };
 
 //!
@@ -72,28 +84,33 @@ class Cards
 
     //! Returns a list of cards that matches \p rarity.
     //! \param rarity The rarity of the card.
-    //! \return A list of cards that matches condition.
-    static std::vector<Card*> FindCardByRarity(Rarity rarity);
+    //! \return A list of cards that matches condition. It refers to the
+    //! index that is built when loading cards, so it doesn't allocate.
+    static const std::vector<Card*>& FindCardByRarity(Rarity rarity);
 
     //! Returns a list of cards that matches \p cardClass.
     //! \param cardClass The class of the card.
-    //! \return A list of cards that matches condition.
-    static std::vector<Card*> FindCardByClass(CardClass cardClass);
+    //! \return A list of cards that matches condition. It refers to the
+    //! index that is built when loading cards, so it doesn't allocate.
+    static const std::vector<Card*>& FindCardByClass(CardClass cardClass);
 
     //! Returns a list of cards that matches \p cardSet.
     //! \param cardSet The set of the card.
-    //! \return A list of cards that matches condition.
-    static std::vector<Card*> FindCardBySet(CardSet cardSet);
+    //! \return A list of cards that matches condition. It refers to the
+    //! index that is built when loading cards, so it doesn't allocate.
+    static const std::vector<Card*>& FindCardBySet(CardSet cardSet);
 
     //! Returns a list of cards that matches \p cardType.
     //! \param cardType The type of the card.
-    //! \return A list of cards that matches condition.
-    static std::vector<Card*> FindCardByType(CardType cardType);
+    //! \return A list of cards that matches condition. It refers to the
+    //! index that is built when loading cards, so it doesn't allocate.
+    static const std::vector<Card*>& FindCardByType(CardType cardType);
 
     //! Returns a list of cards that matches \p race.
     //! \param race The race of the card.
-    //! \return A list of cards that matches condition.
-    static std::vector<Card*> FindCardByRace(Race race);
+    //! \return A list of cards that matches condition. It refers to the
+    //! index that is built when loading cards, so it doesn't allocate.
+    static const std::vector<Card*>& FindCardByRace(Race race);
 
     //! Returns a card that matches \p name.
     //! \param name The name of the card.
@@ -130,6 +147,29 @@ class Cards
     //! \return A list of cards that matches condition.
     static std::vector<Card*> FindCardByGameTag(std::vector<GameTag> gameTags);
 
+    //! Returns a list of cards that matches all conditions of \p filter.
+    //! It chooses the smallest index among the conditions of \p filter and
+    //! checks the remaining conditions in one pass over it.
+    //! \param filter The search filter to apply.
+    //! \return A list of cards that matches condition.
+    static std::vector<Card*> FindCards(const SearchFilter& filter);
+
+    //! Returns a pool of cards to pick randomly that matches \p cardType,
+    //! \p cardClass and \p race. INVALID matches any value. The pool is
+    //! built when loading cards and is never changed.
+    //! \param cardType The type of the card.
+    //! \param cardClass The class of the card.
+    //! \param race The race of the card.
+    //! \return A pool of cards that matches condition.
+    static const std::vector<Card*>& GetRandomCardPool(CardType cardType,
+                                                       CardClass cardClass,
+                                                       Race race);
+
+    //! Returns a list of entourage cards of \p card.
+    //! \param card The card that has entourages.
+    //! \return A list of entourage cards in the order of the entourages.
+    static const std::vector<Card*>& GetEntourageCards(const Card* card);
+
     //! Returns a hero card that matches \p cardClass.
     //! \param cardClass The class of the card.
     //! \return A hero card that matches condition.
@@ -141,13 +181,55 @@ class Cards
     static Card* GetDefaultHeroPower(CardClass cardClass);
 
  private:
-    //! Constructor: Loads card data.
+    //! Constructor: Loads card data and builds the indexes of ID, dbfID
+    //! and name.
     Cards();
 
     //! Destructor: Releases card data.
     ~Cards();
 
+    //! Builds the indexes of card attributes.
+    static void BuildIndexes();
+
+    //! Returns a list of cards whose value of \p index is between
+    //! \p minVal and \p maxVal. The cards are in the order of m_cards.
+    //! \param index The index of the value of the card.
+    //! \param minVal The minimum value of the card.
+    //! \param maxVal The maximum value of the card.
+    //! \return A list of cards that matches condition.
+    static std::vector<Card*> FindCardByRange(
+        const std::map<int, std::vector<Card*>>& index, int minVal,
+        int maxVal);
+
+    //! Returns whether \p card matches all conditions of \p filter.
+    //! \param card The card to check.
+    //! \param filter The search filter to apply.
+    //! \return Flag that indicates whether the card matches condition.
+    static bool IsMatched(const Card* card, const SearchFilter& filter);
+
     static std::vector<Card*> m_cards;
+    static std::unordered_map<const Card*, std::size_t> m_cardIndexes;
+
+    static std::unordered_map<std::string, Card*> m_cardsByID;
+    static std::unordered_map<int, Card*> m_cardsByDbfID;
+    static std::unordered_map<std::string, Card*> m_cardsByName;
+
+    static std::map<Rarity, std::vector<Card*>> m_cardsByRarity;
+    static std::map<CardClass, std::vector<Card*>> m_cardsByClass;
+    static std::map<CardSet, std::vector<Card*>> m_cardsBySet;
+    static std::map<CardType, std::vector<Card*>> m_cardsByType;
+    static std::map<Race, std::vector<Card*>> m_cardsByRace;
+    static std::map<GameTag, std::vector<Card*>> m_cardsByGameTag;
+    static std::map<int, std::vector<Card*>> m_cardsByCost;
+    static std::map<int, std::vector<Card*>> m_cardsByAttack;
+    static std::map<int, std::vector<Card*>> m_cardsByHealth;
+    static std::map<int, std::vector<Card*>> m_cardsBySpellPower;
+    static std::vector<Card*> m_collectibleCards;
+
+    static std::map<std::tuple<CardType, CardClass, Race>, std::vector<Card*>>
+        m_randomCardPools;
+    static std::unordered_map<std::string, std::vector<Card*>>
+        m_entourageCards;
 };
 }  // namespace RosettaStone
 
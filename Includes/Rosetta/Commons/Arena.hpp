@@ -0,0 +1,149 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_ARENA_HPP
+#define ROSETTASTONE_ARENA_HPP
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief Arena class.
+//!
+//! This class is a memory pool that holds the objects of a game. The memory
+//! is carved out of large blocks and the freed memory is kept in the free
+//! list for each size class, so the objects of the same size reuse it without
+//! calling global allocator. The memory larger than the maximum allocation
+//! size is allocated from global allocator one by one and linked to the list
+//! of large blocks. All blocks are released at once when the arena is
+//! destroyed, including the memory of the objects that are never deleted.
+//! It is not thread-safe because a game is processed by one thread at a time.
+//!
+class Arena
+{
+ public:
+    //! The size of a block that is requested to global allocator.
+    static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+
+    //! The maximum size of memory that is allocated from the blocks. The
+    //! larger memory is allocated from global allocator and is tracked by the
+    //! arena.
+    static constexpr std::size_t MAX_ALLOC_SIZE = 1024;
+
+    //! Default constructor.
+    Arena() = default;
+
+    //! Destructor. It releases all blocks.
+    ~Arena();
+
+    //! Deleted copy constructor.
+    Arena(const Arena&) = delete;
+
+    //! Deleted move constructor.
+    Arena(Arena&&) = delete;
+
+    //! Deleted copy assignment operator.
+    Arena& operator=(const Arena&) = delete;
+
+    //! Deleted move assignment operator.
+    Arena& operator=(Arena&&) = delete;
+
+    //! Allocates memory of \p size bytes.
+    //! \param size The size of memory to allocate.
+    //! \return The pointer to the allocated memory.
+    void* Allocate(std::size_t size);
+
+    //! Returns memory of \p size bytes to the free list.
+    //! \param ptr The pointer to the memory that is allocated by this arena.
+    //! \param size The size of memory that is passed to Allocate().
+    void Deallocate(void* ptr, std::size_t size);
+
+    //! Releases all blocks at once. The memory allocated by this arena must
+    //! not be used after it is called.
+    void Release();
+
+    //! Returns the number of blocks that are requested to global allocator.
+    //! \return The number of blocks.
+    std::size_t GetNumBlocks() const;
+
+    //! Returns the number of large blocks that are not deallocated yet.
+    //! \return The number of large blocks.
+    std::size_t GetNumLargeBlocks() const;
+
+ private:
+    static constexpr std::size_t ALIGNMENT = 16;
+    static constexpr std::size_t NUM_SIZE_CLASSES = MAX_ALLOC_SIZE / ALIGNMENT;
+
+    struct FreeNode
+    {
+        FreeNode* next;
+    };
+
+    //! The header that is placed in front of the large block.
+    struct LargeBlock
+    {
+        LargeBlock* prev;
+        LargeBlock* next;
+    };
+
+    static constexpr std::size_t LARGE_BLOCK_HEADER_SIZE = ALIGNMENT;
+
+    std::vector<void*> m_blocks;
+    LargeBlock* m_largeBlocks = nullptr;
+    std::size_t m_numLargeBlocks = 0;
+    std::array<FreeNode*, NUM_SIZE_CLASSES> m_freeLists{};
+
+    char* m_cur = nullptr;
+    char* m_end = nullptr;
+};
+
+//!
+//! \brief ArenaObject class.
+//!
+//! This class is a base class of the objects that can be allocated from the
+//! arena of a game. The object records the arena that it is allocated from,
+//! so it can be deleted in the same way regardless of the arena. The object
+//! that is allocated without the arena comes from global allocator.
+//!
+class ArenaObject
+{
+ public:
+    //! Allocates memory for the object from global allocator.
+    //! \param size The size of the object.
+    //! \return The pointer to the allocated memory.
+    static void* operator new(std::size_t size);
+
+    //! Allocates memory for the object from \p arena.
+    //! \param size The size of the object.
+    //! \param arena The arena to allocate, or nullptr to use global allocator.
+    //! \return The pointer to the allocated memory.
+    static void* operator new(std::size_t size, Arena* arena);
+
+    //! Returns memory of the object to the allocator that it is allocated from.
+    //! \param ptr The pointer to the object.
+    static void operator delete(void* ptr);
+
+    //! Returns memory of the object when the constructor throws.
+    //! \param ptr The pointer to the object.
+    //! \param arena The arena that is passed to operator new.
+    static void operator delete(void* ptr, Arena* arena);
+
+ private:
+    //! The header that is placed in front of the object.
+    struct Header
+    {
+        Arena* arena;
+        std::size_t size;
+    };
+
+    static constexpr std::size_t HEADER_SIZE = 16;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_ARENA_HPP
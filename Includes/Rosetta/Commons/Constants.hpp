@@ -15,6 +15,10 @@ constexpr float VERSION = 0.4f;
 //! Deck code version.
 constexpr int DECK_CODE_VERSION = 1;
 
+//! Binary card data version.
+//! \note Increase it when the layout of binary card data is changed.
+constexpr int CARD_DATA_VERSION = 3;
+
 //! The number of player class.
 //! \note Druid, Hunter, Mage, Paladin, Priest, Rogue, Shaman, Warlock, Warrior
 constexpr int NUM_PLAYER_CLASS = 9;
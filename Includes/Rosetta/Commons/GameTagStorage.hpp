@@ -0,0 +1,88 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_GAME_TAG_STORAGE_HPP
+#define ROSETTASTONE_GAME_TAG_STORAGE_HPP
+
+#include <Rosetta/Enums/CardEnums.hpp>
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace RosettaStone
+{
+//! The number of game tags that are stored in the dense array.
+constexpr std::size_t NUM_HOT_GAME_TAGS = 62;
+
+//!
+//! \brief GameTagStorage class.
+//!
+//! This class is a flat container for the values of game tags. The game tags
+//! that are used frequently in the game are stored in the dense array and
+//! the presence of them is recorded in the bit flags, so they can be found
+//! without any tree lookup. The other game tags are stored in the small
+//! vector that is sorted by game tag.
+//!
+class GameTagStorage
+{
+ public:
+    //! Default constructor.
+    GameTagStorage() = default;
+
+    //! Constructs game tag storage with given \p tags.
+    //! \param tags The game tags and the values of them.
+    explicit GameTagStorage(std::map<GameTag, int> tags);
+
+    //! Returns whether the storage contains the value of game tag.
+    //! \param tag The game tag to find.
+    //! \return Flag that indicates whether the storage contains the value.
+    bool Contains(GameTag tag) const;
+
+    //! Finds the value of game tag.
+    //! \param tag The game tag to find.
+    //! \return The pointer to the value, or nullptr if it does not exist.
+    const int* Find(GameTag tag) const;
+
+    //! Returns the value of game tag.
+    //! \param tag The game tag to find.
+    //! \return The value of game tag, or 0 if it does not exist.
+    int Get(GameTag tag) const;
+
+    //! Sets the value of game tag.
+    //! \param tag The game tag to set.
+    //! \param value The value to set for game tag.
+    void Set(GameTag tag, int value);
+
+    //! Erases the value of game tag.
+    //! \param tag The game tag to erase.
+    void Erase(GameTag tag);
+
+    //! Erases the values of all game tags.
+    void Clear();
+
+    //! Returns the game tags and the values of them as a map.
+    //! \return The map of game tags and the values of them.
+    std::map<GameTag, int> ToMap() const;
+
+    //! Returns the hash of the stored game tags and the values of them. Only
+    //! the game tags that the reduced board view can see are hashed. It is
+    //! the sum of the mixed pairs, so it is updated in constant time whenever
+    //! a value is set or erased.
+    //! \return The hash of the stored game tags.
+    std::uint64_t GetHash() const;
+
+ private:
+    std::uint64_t m_flags = 0;
+    std::array<int, NUM_HOT_GAME_TAGS> m_values{};
+    std::vector<std::pair<GameTag, int>> m_extraTags;
+    std::uint64_t m_hash = 0;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_GAME_TAG_STORAGE_HPP
@@ -0,0 +1,133 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_RANDOM_HPP
+#define ROSETTASTONE_RANDOM_HPP
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace RosettaStone
+{
+//!
+//! \brief Random class.
+//!
+//! This class is a seedable pseudo random number generator based on
+//! xoshiro256** (http://prng.di.unimi.it). Each game owns its own generator,
+//! so a game can be replayed with the same seed and games that are running
+//! in different threads don't share any state. Unlike the distributions of
+//! the standard library, it produces the same sequence on every platform.
+//!
+class Random
+{
+ public:
+    using result_type = std::uint64_t;
+
+    //! Constructs random number generator with the seed from the system.
+    Random();
+
+    //! Constructs random number generator with given \p seed.
+    //! \param seed The seed of random number generator.
+    explicit Random(std::uint64_t seed);
+
+    //! Reseeds random number generator.
+    //! \param seed The seed of random number generator.
+    void Seed(std::uint64_t seed);
+
+    //! Returns the minimum value that can be generated.
+    //! \return The minimum value that can be generated.
+    static constexpr result_type min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    //! Returns the maximum value that can be generated.
+    //! \return The maximum value that can be generated.
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    //! Generates the next random number.
+    //! \return The next random number.
+    result_type operator()();
+
+    //! Returns the random number in the range [\p min, \p max].
+    //! If T is a floating point type, the range is [\p min, \p max).
+    //! \param min The minimum value of the range.
+    //! \param max The maximum value of the range.
+    //! \return The random number in the range.
+    template <typename T>
+    T Get(T min, T max)
+    {
+        static_assert(std::is_arithmetic_v<T>, "T must be arithmetic type.");
+
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            const double unit =
+                static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+            return min + static_cast<T>(unit * (max - min));
+        }
+        else
+        {
+            const auto range = static_cast<std::uint64_t>(max) -
+                               static_cast<std::uint64_t>(min);
+            return static_cast<T>(static_cast<std::uint64_t>(min) +
+                                  GetBounded(range));
+        }
+    }
+
+    //! Returns the iterator to the random element of \p container. It throws
+    //! std::out_of_range if \p container is empty.
+    //! \param container The container that is not empty.
+    //! \return The iterator to the random element.
+    template <typename Container>
+    auto Get(Container& container) -> decltype(std::begin(container))
+    {
+        const auto size = static_cast<std::uint64_t>(
+            std::distance(std::begin(container), std::end(container)));
+        if (size == 0)
+        {
+            throw std::out_of_range(
+                "Can't get a random element of an empty container");
+        }
+
+        return std::next(std::begin(container), GetBounded(size - 1));
+    }
+
+    //! Shuffles the elements in the range [\p first, \p last).
+    //! \param first The iterator to the first element.
+    //! \param last The iterator past the last element.
+    template <typename Iterator>
+    void Shuffle(Iterator first, Iterator last)
+    {
+        const auto size =
+            static_cast<std::uint64_t>(std::distance(first, last));
+
+        for (std::uint64_t i = size; i > 1; --i)
+        {
+            const auto j = GetBounded(i - 1);
+            using std::swap;
+            swap(first[i - 1], first[j]);
+        }
+    }
+
+ private:
+    //! Returns the uniform random number in the range [0, \p range].
+    //! \param range The maximum value of the range.
+    //! \return The uniform random number in the range.
+    std::uint64_t GetBounded(std::uint64_t range);
+
+    std::array<std::uint64_t, 4> m_state{};
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_RANDOM_HPP
@@ -8,6 +8,7 @@
 #define ROSETTASTONE_UTILS_HPP
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <vector>
@@ -36,6 +37,19 @@ void CombineHash(std::size_t& seed, const T& v)
     seed ^= std::hash<T>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
 }
 
+//! Mixes the bits of \p value so that close values are mapped to unrelated
+//! values. It is the finalizer of SplitMix64.
+//! \param value The value to mix.
+//! \return The mixed value.
+constexpr std::uint64_t MixHash(std::uint64_t value)
+{
+    value += 0x9e3779b97f4a7c15;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+
+    return value ^ (value >> 31);
+}
+
 //! Erases item if it is matched predicate.
 //! \param items A container consists of item.
 //! \param predicate The condition to erase item.
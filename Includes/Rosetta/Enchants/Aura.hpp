@@ -78,6 +78,11 @@ class Aura : public IAura
     //! \param clone The entity to clone aura effect.
     void Clone(Entity* clone) override;
 
+    //! Copies aura effect to the cloned game.
+    //! \param entities The map of entities to the entities cloned from them.
+    //! \return A copy of aura effect that is allocated dynamically.
+    IAura* Copy(const std::map<const Entity*, Entity*>& entities) override;
+
     //! Removes entity to update a list of entities.
     //! \param entity An entity to remove.
     void RemoveEntity(Entity* entity);
@@ -161,6 +166,11 @@ class AdaptiveEffect : public Aura
     //! \param clone The entity to clone aura effect.
     void Clone(Entity* clone) override;
 
+    //! Copies aura effect to the cloned game.
+    //! \param entities The map of entities to the entities cloned from them.
+    //! \return A copy of aura effect that is allocated dynamically.
+    IAura* Copy(const std::map<const Entity*, Entity*>& entities) override;
+
  private:
     //! Constructs adaptive effect with given \p prototype and \p owner.
     //! \param prototype An adaptive effect for prototype.
@@ -201,6 +211,11 @@ class EnrageEffect : public Aura
     //! \param clone The entity to clone aura effect.
     void Clone(Entity* clone) override;
 
+    //! Copies aura effect to the cloned game.
+    //! \param entities The map of entities to the entities cloned from them.
+    //! \return A copy of aura effect that is allocated dynamically.
+    IAura* Copy(const std::map<const Entity*, Entity*>& entities) override;
+
  private:
     //! Constructs enrage effect with given \p prototype and \p owner.
     //! \param prototype An enrage effect for prototype.
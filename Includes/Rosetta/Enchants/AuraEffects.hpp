@@ -6,9 +6,8 @@
 #ifndef ROSETTASTONE_AURA_EFFECTS_HPP
 #define ROSETTASTONE_AURA_EFFECTS_HPP
 
-#include <Rosetta/Enums/CardEnums.hpp>
-
-#include <map>
+#include <Rosetta/Commons/Arena.hpp>
+#include <Rosetta/Commons/GameTagStorage.hpp>
 
 namespace RosettaStone
 {
@@ -20,13 +19,18 @@ class Entity;
 //! This class is a simple container for saving tag value perturbations from
 //! external auras. Call indexer to get value for a particular tag.
 //!
-class AuraEffects
+class AuraEffects : public ArenaObject
 {
  public:
     //! Constructs aura effects with given \p owner.
     //! \param owner The owner of aura effects.
     explicit AuraEffects(Entity* owner);
 
+    //! Constructs aura effects by copying the values of \p prototype.
+    //! \param prototype The aura effects to copy the values.
+    //! \param owner The owner of aura effects.
+    AuraEffects(const AuraEffects& prototype, Entity* owner);
+
     //! Returns the owner of aura effects.
     //! \return The owner of aura effects.
     Entity* GetOwner() const;
@@ -44,7 +48,7 @@ class AuraEffects
  private:
     Entity* m_owner = nullptr;
 
-    std::map<GameTag, int> m_gameTags;
+    GameTagStorage m_gameTags;
 };
 }  // namespace RosettaStone
 
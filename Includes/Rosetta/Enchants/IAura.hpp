@@ -6,15 +6,21 @@
 #ifndef ROSETTASTONE_IAURA_HPP
 #define ROSETTASTONE_IAURA_HPP
 
+#include <Rosetta/Commons/Arena.hpp>
+
+#include <map>
+
 namespace RosettaStone
 {
+class Entity;
+
 //!
 //! \brief IAura class.
 //!
 //! This class is interface for effects of enchantments that should be updated
 //! during Game::UpdateAura().
 //!
-class IAura
+class IAura : public ArenaObject
 {
  public:
     //! Default destructor.
@@ -29,6 +35,12 @@ class IAura
     //! Clones aura effect to \p clone.
     //! \param clone The entity to clone aura effect.
     virtual void Clone(Entity* clone) = 0;
+
+    //! Copies aura effect to the cloned game. The owner and the affected
+    //! entities are replaced by the entities cloned from them.
+    //! \param entities The map of entities to the entities cloned from them.
+    //! \return A copy of aura effect that is allocated dynamically.
+    virtual IAura* Copy(const std::map<const Entity*, Entity*>& entities) = 0;
 };
 }  // namespace RosettaStone
 
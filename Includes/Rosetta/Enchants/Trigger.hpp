@@ -6,6 +6,7 @@
 #ifndef ROSETTASTONE_TRIGGER_HPP
 #define ROSETTASTONE_TRIGGER_HPP
 
+#include <Rosetta/Commons/Arena.hpp>
 #include <Rosetta/Conditions/SelfCondition.hpp>
 #include <Rosetta/Enums/TriggerEnums.hpp>
 
@@ -24,9 +25,12 @@ class ITask;
 //! This class represents triggered effects that are effects that activate in
 //! response to specific events.
 //!
-class Trigger
+class Trigger : public ArenaObject
 {
  public:
+    //! The index of event slot that indicates the trigger is not subscribed.
+    static constexpr std::size_t INVALID_EVENT_INDEX = static_cast<std::size_t>(-1);
+
     //! Constructs trigger with given \p type.
     //! \param type The trigger type.
     explicit Trigger(TriggerType type);
@@ -45,7 +49,7 @@ class Trigger
                   bool cloning = false);
 
     //! Removes this object from game and unsubscribe from the related event.
-    void Remove() const;
+    void Remove();
 
     //! Checks triggers related to the current Sequence at once before sequence
     //! starts.
@@ -64,6 +68,14 @@ class Trigger
     bool removeAfterTriggered = false;
 
  private:
+    friend class TriggerEvent;
+
+    //! Invokes trigger when the event that it listens to occurs. It is
+    //! processed with the probability of the trigger.
+    //! \param player The player.
+    //! \param source The source of trigger.
+    void Invoke(Player* player, Entity* source);
+
     //! Processes trigger to apply the effect.
     //! \param player The player.
     //! \param source The source of trigger.
@@ -85,6 +97,7 @@ class Trigger
     TriggerActivation m_triggerActivation = TriggerActivation::PLAY;
     SequenceType m_sequenceType = SequenceType::NONE;
 
+    std::size_t m_eventIndex = INVALID_EVENT_INDEX;
     bool m_isValidated = false;
 };
 }  // namespace RosettaStone
@@ -7,6 +7,9 @@
 #ifndef ROSETTASTONE_CARD_ENUMS_HPP
 #define ROSETTASTONE_CARD_ENUMS_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <string_view>
 
@@ -20,7 +23,7 @@ enum class CardClass
 #undef X
 };
 
-const std::string CARD_CLASS_STR[] = {
+constexpr std::string_view CARD_CLASS_STR[] = {
 #define X(a) #a,
 #include "CardClass.def"
 #undef X
@@ -34,7 +37,7 @@ enum class CardSet
 #undef X
 };
 
-const std::string CARD_SET_STR[] = {
+constexpr std::string_view CARD_SET_STR[] = {
 #define X(a) #a,
 #include "CardSet.def"
 #undef X
@@ -48,7 +51,7 @@ enum class CardType
 #undef X
 };
 
-const std::string CARD_TYPE_STR[] = {
+constexpr std::string_view CARD_TYPE_STR[] = {
 #define X(a) #a,
 #include "CardType.def"
 #undef X
@@ -62,7 +65,7 @@ enum class Faction
 #undef X
 };
 
-const std::string FACTION_STR[] = {
+constexpr std::string_view FACTION_STR[] = {
 #define X(a) #a,
 #include "Faction.def"
 #undef X
@@ -76,7 +79,7 @@ enum class GameTag
 #undef X
 };
 
-const std::string GAME_TAG_STR[] = {
+constexpr std::string_view GAME_TAG_STR[] = {
 #define X(a) #a,
 #include "GameTag.def"
 #undef X
@@ -90,7 +93,7 @@ enum class PlayReq
 #undef X
 };
 
-const std::string PLAY_REQ_STR[] = {
+constexpr std::string_view PLAY_REQ_STR[] = {
 #define X(a) #a,
 #include "PlayReq.def"
 #undef X
@@ -104,7 +107,7 @@ enum class Race
 #undef X
 };
 
-const std::string RACE_STR[] = {
+constexpr std::string_view RACE_STR[] = {
 #define X(a) #a,
 #include "Race.def"
 #undef X
@@ -118,7 +121,7 @@ enum class Rarity
 #undef X
 };
 
-const std::string RARITY_STR[] = {
+constexpr std::string_view RARITY_STR[] = {
 #define X(a) #a,
 #include "Rarity.def"
 #undef X
@@ -236,15 +239,78 @@ T StrToEnum(const std::string_view&);
 template <class T>
 std::string_view EnumToStr(T);
 
+//! Returns the FNV-1a hash value of the name of enumerator.
+//! \param str The name of enumerator.
+//! \return The hash value of \p str.
+constexpr std::uint32_t HashEnumStr(std::string_view str)
+{
+    std::uint32_t hash = 2166136261u;
+
+    for (const char c : str)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+//! Returns the number of slots in the hash table of enumerators. It is a power
+//! of two that keeps the load factor at most 0.5.
+//! \param numEnums The number of enumerators.
+//! \return The number of slots in the hash table.
+constexpr std::size_t GetEnumTableSize(std::size_t numEnums)
+{
+    std::size_t size = 1;
+
+    while (size < numEnums * 2)
+    {
+        size *= 2;
+    }
+
+    return size;
+}
+
+//! Makes the open addressing hash table that maps the name of enumerator to
+//! its value. Each slot stores the value plus one, and 0 means an empty slot.
+//! \param names The names of enumerators.
+//! \return The hash table of enumerators.
+template <std::size_t N>
+constexpr std::array<std::uint16_t, GetEnumTableSize(N)> MakeEnumTable(
+    const std::string_view (&names)[N])
+{
+    static_assert(N < UINT16_MAX, "Too many enumerators for the hash table.");
+
+    constexpr std::size_t mask = GetEnumTableSize(N) - 1;
+    std::array<std::uint16_t, GetEnumTableSize(N)> table{};
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        std::size_t slot = HashEnumStr(names[i]) & mask;
+        while (table[slot] != 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+
+        table[slot] = static_cast<std::uint16_t>(i + 1);
+    }
+
+    return table;
+}
+
 #define STR2ENUM(TYPE, ARRAY)                                                \
     template <>                                                              \
     inline TYPE StrToEnum<TYPE>(const std::string_view& str)                 \
     {                                                                        \
-        for (std::size_t i = 0; i < (sizeof(ARRAY) / sizeof(ARRAY[0])); ++i) \
+        static constexpr auto table = MakeEnumTable(ARRAY);                  \
+        constexpr std::size_t mask = table.size() - 1;                       \
+                                                                             \
+        for (std::size_t slot = HashEnumStr(str) & mask; table[slot] != 0;   \
+             slot = (slot + 1) & mask)                                       \
         {                                                                    \
-            if (ARRAY[i] == str)                                             \
+            if (ARRAY[table[slot] - 1] == str)                               \
             {                                                                \
-                return TYPE(i);                                              \
+                return TYPE(table[slot] - 1);                                \
             }                                                                \
         }                                                                    \
                                                                              \
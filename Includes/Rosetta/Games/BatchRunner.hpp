@@ -0,0 +1,106 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_BATCH_RUNNER_HPP
+#define ROSETTASTONE_BATCH_RUNNER_HPP
+
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/GameConfig.hpp>
+#include <Rosetta/Policies/Policy.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief GameResult struct.
+//!
+//! This struct holds the result of a game that is played by BatchRunner.
+//!
+struct GameResult
+{
+    //! The play state of player 1 when the game is over.
+    PlayState player1State = PlayState::INVALID;
+
+    //! The play state of player 2 when the game is over.
+    PlayState player2State = PlayState::INVALID;
+
+    //! The number of turns that are played.
+    int turns = 0;
+
+    //! The time that is taken to play the game.
+    std::chrono::nanoseconds elapsedTime{ 0 };
+
+    //! The profiler of the tasks that are processed in the game. It is
+    //! filled only if the task profiler is compiled in.
+    TaskProfiler taskProfiler;
+};
+
+//!
+//! \brief BatchRunner class.
+//!
+//! This class plays many games with Game::PlayPolicy() at once. Games are
+//! distributed to the worker threads in contiguous ranges, and a worker that
+//! finishes its range steals half of the remaining games from another worker.
+//! Each game is played with a fresh policy from the factories and its own
+//! random number generator, so the results only depend on the seeds of the
+//! game configs.
+//!
+class BatchRunner
+{
+ public:
+    using PolicyFactory = std::function<std::unique_ptr<IPolicy>()>;
+
+    //! Constructs batch runner with given policy factories and \p numThreads.
+    //! \param player1Policy The factory that creates the policy of player 1.
+    //! \param player2Policy The factory that creates the policy of player 2.
+    //! \param numThreads The number of worker threads. If it is 0, the number
+    //! of hardware threads is used.
+    BatchRunner(PolicyFactory player1Policy, PolicyFactory player2Policy,
+                std::size_t numThreads = 0);
+
+    //! Returns the number of worker threads.
+    //! \return The number of worker threads.
+    std::size_t GetNumThreads() const;
+
+    //! Plays a game for each game config.
+    //! \param configs The game configs. Configs without seed are played with
+    //! the seed from the system.
+    //! \return The results of games in the order of \p configs.
+    std::vector<GameResult> Run(const std::vector<GameConfig>& configs) const;
+
+    //! Plays a game for each seed with the same game config.
+    //! \param config The game config.
+    //! \param seeds The seeds of games.
+    //! \return The results of games in the order of \p seeds.
+    std::vector<GameResult> Run(const GameConfig& config,
+                                const std::vector<std::uint64_t>& seeds) const;
+
+ private:
+    //! Plays \p numGames games in the worker threads.
+    //! \param numGames The number of games.
+    //! \param play The function that plays the game of given index.
+    //! \return The results of games in the order of index.
+    std::vector<GameResult> Run(
+        std::size_t numGames,
+        const std::function<GameResult(std::size_t)>& play) const;
+
+    //! Plays \p game with the policies from the factories.
+    //! \param game The game to play.
+    //! \return The result of the game.
+    GameResult Play(Game& game) const;
+
+    PolicyFactory m_player1Policy;
+    PolicyFactory m_player2Policy;
+    std::size_t m_numThreads;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_BATCH_RUNNER_HPP
@@ -6,15 +6,19 @@
 #ifndef ROSETTASTONE_GAME_HPP
 #define ROSETTASTONE_GAME_HPP
 
+#include <Rosetta/Commons/Arena.hpp>
+#include <Rosetta/Commons/Random.hpp>
 #include <Rosetta/Enums/CardEnums.hpp>
 #include <Rosetta/Games/GameConfig.hpp>
 #include <Rosetta/Games/TriggerManager.hpp>
+#include <Rosetta/Games/ZobristHash.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Tasks/TaskQueue.hpp>
 #include <Rosetta/Tasks/TaskStack.hpp>
 #include <Rosetta/Views/ReducedBoardView.hpp>
 
 #include <map>
+#include <memory>
 
 namespace RosettaStone
 {
@@ -39,9 +43,6 @@ class Game
     //! Default destructor.
     ~Game() = default;
 
-    //! Deleted copy constructor.
-    Game(const Game&) = delete;
-
     //! Deleted move constructor.
     Game(Game&&) = delete;
 
@@ -55,6 +56,18 @@ class Game
     //! \param rhs The source to copy the content.
     void RefCopyFrom(const Game& rhs);
 
+    //! Creates a deep copy of the game. Players, zones, entities, applied
+    //! enchantments, auras, triggers and the task queue are copied, and all
+    //! pointers are remapped to the objects of the copied game. The game config
+    //! is not copied but shared because it doesn't change.
+    //! \return The copied game that is independent of this game.
+    std::unique_ptr<Game> Clone() const;
+
+    //! Returns the config that the game is constructed with. Note that the
+    //! cards in the decks are reversed if the game doesn't shuffle them.
+    //! \return The config of the game.
+    const GameConfig& GetGameConfig() const;
+
     //! Returns the first player.
     //! \return The first player.
     Player& GetPlayer1();
@@ -164,6 +177,11 @@ class Game
     //! \param task The game task to execute.
     PlayState Process(Player& player, ITask&& task);
 
+    //! Processes the steps from the next step until the game needs the input
+    //! of player or is over. If auto run is disabled, only the next step and
+    //! the steps to finish the game are processed.
+    void ProcessSteps();
+
     //! Process game until given step arriving.
     //! \param step The game step to process until arrival.
     void ProcessUntil(Step step);
@@ -179,6 +197,30 @@ class Game
     //! \return The reduced board view.
     ReducedBoardView CreateView() const;
 
+    //! Returns the hash of the game state that \p viewer can see. It is kept
+    //! incrementally as the game tags and the zones of entities change, so
+    //! it is returned in constant time. The cards in the hand and the secrets
+    //! of the opponent and the cards in each deck are counted but not hashed.
+    //! \param viewer The player who views the game state.
+    //! \return The hash of the game state for the player.
+    std::uint64_t GetHash(PlayerType viewer) const;
+
+    //! Returns the profiler of the tasks that are processed in this game.
+    //! It is filled only if the task profiler is compiled in.
+    //! \return The profiler of the tasks.
+    TaskProfiler& GetTaskProfiler();
+
+    //! Returns the profiler of the tasks that are processed in this game.
+    //! It is filled only if the task profiler is compiled in.
+    //! \return The profiler of the tasks.
+    const TaskProfiler& GetTaskProfiler() const;
+
+    //! Returns the arena that the entities, the triggers and the auras of
+    //! this game are allocated from. It is released when the game is
+    //! destroyed, so the objects must not outlive the game.
+    //! \return The arena of this game.
+    Arena& GetArena();
+
     State state = State::INVALID;
 
     Step step = Step::INVALID;
@@ -187,6 +229,9 @@ class Game
     TaskQueue taskQueue;
     TaskStack taskStack;
     TriggerManager triggerManager;
+    ZobristHash zobristHash;
+
+    Random random;
 
     std::vector<IAura*> auras;
     std::vector<Trigger*> triggers;
@@ -195,10 +240,38 @@ class Game
     std::map<std::size_t, Minion*> deadMinions;
 
  private:
-    //! Checks whether the game is over.
-    PlayState CheckGameOver();
-
-    GameConfig m_gameConfig;
+    //! Constructs game by deep copying \p rhs. It is used by Clone().
+    //! \param rhs The source to copy the content.
+    Game(const Game& rhs);
+
+    //! Processes the steps from the next step one by one with GameManager.
+    //! It stops at the step that keeps the next step because it waits for the
+    //! input of player or the game is over, or when \p untilStep arrives.
+    //! \param untilStep The step to stop before processing it.
+    //! \param autoRun Flag that indicates whether to process the steps after
+    //! the next step.
+    void RunSteps(Step untilStep, bool autoRun);
+
+    //! Processes the steps after a task. It finishes the game if it is over
+    //! in the task, or runs the steps from the next step if the task has set
+    //! it, e.g. to end the turn.
+    //! \param prevNextStep The next step before the task is processed.
+    void ProcessTaskSteps(Step prevNextStep);
+
+    //! Checks whether the game is over and sets the next step to wrap up the
+    //! game if it is.
+    //! \return Flag that indicates whether the game is over.
+    bool CheckGameOver();
+
+    // The config is shared by the copies of the game because it doesn't change
+    // after the game is constructed. The entities of all copies point to the
+    // cards in its decks.
+    std::shared_ptr<GameConfig> m_gameConfig;
+    bool m_autoRun = true;
+
+    // The arena must be declared before the players because the entities are
+    // deleted through it when the players are destroyed.
+    Arena m_arena;
 
     std::array<Player, 2> m_players;
     std::size_t m_turn = 0;
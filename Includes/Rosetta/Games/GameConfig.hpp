@@ -10,6 +10,8 @@
 #include <Rosetta/Commons/Constants.hpp>
 
 #include <array>
+#include <cstdint>
+#include <optional>
 
 namespace RosettaStone
 {
@@ -33,6 +35,10 @@ struct GameConfig
         "UNG_920", "UNG_940", "UNG_942", "UNG_954"
     };
 
+    //! The seed of the random number generator of the game. If it is not set,
+    //! the seed is obtained from the system.
+    std::optional<std::uint64_t> seed;
+
     bool doFillDecks = false;
     bool doShuffle = true;
     bool skipMulligan = true;
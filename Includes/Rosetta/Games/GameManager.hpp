@@ -16,11 +16,15 @@ namespace RosettaStone
 //! \brief GameManager class.
 //!
 //! This class monitors game and invokes method when a state is changed.
+//! It processes a single step, and Game::ProcessSteps() drives the steps in
+//! a loop so that the call stack doesn't grow with each step.
 //!
 class GameManager
 {
  public:
     //! Invokes method when a state is changed.
+    //! \param game The game context.
+    //! \param step The step to process.
     static void ProcessNextStep(Game& game, Step step);
 };
 }  // namespace RosettaStone
@@ -7,12 +7,60 @@
 #ifndef ROSETTASTONE_TRIGGER_MANAGER_HPP
 #define ROSETTASTONE_TRIGGER_MANAGER_HPP
 
-#include <functional>
+#include <Rosetta/Enums/TriggerEnums.hpp>
+
+#include <cstddef>
+#include <vector>
 
 namespace RosettaStone
 {
 class Entity;
 class Player;
+class Trigger;
+
+//!
+//! \brief TriggerEvent class.
+//!
+//! This class holds the triggers that listen to an event and invokes them in
+//! order of play of their owners. Each trigger keeps the index of its slot,
+//! so it is unsubscribed in constant time by clearing the slot. The cleared
+//! slots are compacted after the event is invoked, and the triggers that are
+//! subscribed while the event is invoked wait for the next event.
+//!
+class TriggerEvent
+{
+ public:
+    //! Subscribes \p trigger to the event.
+    //! \param trigger The trigger to subscribe.
+    void Subscribe(Trigger* trigger);
+
+    //! Unsubscribes \p trigger from the event. It does nothing if the trigger
+    //! doesn't listen to the event.
+    //! \param trigger The trigger to unsubscribe.
+    void Unsubscribe(Trigger* trigger);
+
+    //! Invokes the triggers that listen to the event.
+    //! \param player A player to execute trigger.
+    //! \param sender An entity that is the source of trigger.
+    void Invoke(Player* player, Entity* sender);
+
+    //! Returns whether there is no trigger that listens to the event.
+    //! \return Flag that indicates whether there is no trigger.
+    bool IsEmpty() const;
+
+    //! Returns the number of triggers that listen to the event.
+    //! \return The number of triggers.
+    std::size_t GetCount() const;
+
+ private:
+    //! Removes the cleared slots and sorts the triggers in order of play.
+    void Compact();
+
+    std::vector<Trigger*> m_triggers;
+    std::size_t m_count = 0;
+    int m_depth = 0;
+    bool m_isDirty = false;
+};
 
 //!
 //! \brief TriggerManager class.
@@ -25,81 +73,87 @@ class TriggerManager
     //! Callback for trigger when player's turn is started.
     //! \param player A player to execute trigger.
     //! \param sender An entity that is the source of trigger.
-    void OnStartTurnTrigger(Player* player, Entity* sender) const;
+    void OnStartTurnTrigger(Player* player, Entity* sender);
 
     //! Callback for trigger when player's turn is ended.
     //! \param player A player to execute trigger.
     //! \param sender An entity that is the source of trigger.
-    void OnEndTurnTrigger(Player* player, Entity* sender) const;
+    void OnEndTurnTrigger(Player* player, Entity* sender);
 
     //! Callback for trigger when player plays a card.
     //! \param player A player to execute trigger.
     //! \param sender An entity that is the source of trigger.
-    void OnPlayCardTrigger(Player* player, Entity* sender) const;
+    void OnPlayCardTrigger(Player* player, Entity* sender);
 
     //! Callback for trigger after player plays a minion.
     //! \param player A player to execute trigger.
     //! \param sender An entity that is the source of trigger.
-    void OnAfterPlayMinionTrigger(Player* player, Entity* sender) const;
+    void OnAfterPlayMinionTrigger(Player* player, Entity* sender);
 
     //! Callback for trigger when player plays a spell card.
     //! \param player A player to execute trigger.
     //! \param sender An entity that is the source of trigger.
-    void OnCastSpellTrigger(Player* player, Entity* sender) const;
+    void OnCastSpellTrigger(Player* player, Entity* sender);
 
     //! Callback for trigger after player plays a spell card.
     //! \param player A player to execute trigger.
     //! \param sender An entity that is the source of trigger.
-    void OnAfterCastTrigger(Player* player, Entity* sender) const;
+    void OnAfterCastTrigger(Player* player, Entity* sender);
 
     //! Callback for trigger when entity is healed.
     //! \param player A player to execute trigger.
     //! \param sender An entity that is the source of trigger.
-    void OnHealTrigger(Player* player, Entity* sender) const;
+    void OnHealTrigger(Player* player, Entity* sender);
 
     //! Callback for trigger when entity attacks target.
     //! \param player A player to execute trigger.
     //! \param sender An entity that is the source of trigger.
-    void OnAttackTrigger(Player* player, Entity* sender) const;
+    void OnAttackTrigger(Player* player, Entity* sender);
 
     //! Callback for trigger when entity is summoned.
     //! \param player A player to execute trigger.
     //! \param sender An entity that is the source of trigger.
-    void OnSummonTrigger(Player* player, Entity* sender) const;
+    void OnSummonTrigger(Player* player, Entity* sender);
 
     //! Callback for trigger after entity is summoned.
     //! \param player A player to execute trigger.
     //! \param sender An entity that is the source of trigger.
-    void OnAfterSummonTrigger(Player* player, Entity* sender) const;
+    void OnAfterSummonTrigger(Player* player, Entity* sender);
 
     //! Callback for trigger when entity deals damage.
     //! \param player A player to execute trigger.
     //! \param sender An entity that is the source of trigger.
-    void OnDealDamageTrigger(Player* player, Entity* sender) const;
+    void OnDealDamageTrigger(Player* player, Entity* sender);
 
     //! Callback for trigger when entity is taken damage.
     //! \param player A player to execute trigger.
     //! \param sender An entity that is the source of trigger.
-    void OnTakeDamageTrigger(Player* player, Entity* sender) const;
+    void OnTakeDamageTrigger(Player* player, Entity* sender);
 
     //! Callback for trigger when entity is targeted.
     //! \param player A player to execute trigger.
     //! \param sender An entity that is the source of trigger.
-    void OnTargetTrigger(Player* player, Entity* sender) const;
-
-    std::function<void(Player*, Entity*)> startTurnTrigger;
-    std::function<void(Player*, Entity*)> endTurnTrigger;
-    std::function<void(Player*, Entity*)> playCardTrigger;
-    std::function<void(Player*, Entity*)> afterPlayMinionTrigger;
-    std::function<void(Player*, Entity*)> castSpellTrigger;
-    std::function<void(Player*, Entity*)> afterCastTrigger;
-    std::function<void(Player*, Entity*)> healTrigger;
-    std::function<void(Player*, Entity*)> attackTrigger;
-    std::function<void(Player*, Entity*)> summonTrigger;
-    std::function<void(Player*, Entity*)> afterSummonTrigger;
-    std::function<void(Player*, Entity*)> dealDamageTrigger;
-    std::function<void(Player*, Entity*)> takeDamageTrigger;
-    std::function<void(Player*, Entity*)> targetTrigger;
+    void OnTargetTrigger(Player* player, Entity* sender);
+
+    //! Returns the event that corresponds to \p type.
+    //! \param type The type of trigger.
+    //! \return The event of the trigger type, or nullptr if the trigger type
+    //! is not dispatched by trigger manager.
+    TriggerEvent* GetEvent(TriggerType type);
+
+    TriggerEvent startTurnTrigger;
+    TriggerEvent endTurnTrigger;
+    TriggerEvent playCardTrigger;
+    TriggerEvent afterPlayMinionTrigger;
+    TriggerEvent castSpellTrigger;
+    TriggerEvent afterCastTrigger;
+    TriggerEvent healTrigger;
+    TriggerEvent attackTrigger;
+    TriggerEvent summonTrigger;
+    TriggerEvent afterSummonTrigger;
+    TriggerEvent dealDamageTrigger;
+    TriggerEvent takeDamageTrigger;
+    TriggerEvent targetTrigger;
 };
 }  // namespace RosettaStone
 
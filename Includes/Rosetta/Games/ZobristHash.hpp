@@ -0,0 +1,95 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_ZOBRIST_HASH_HPP
+#define ROSETTASTONE_ZOBRIST_HASH_HPP
+
+#include <Rosetta/Commons/Constants.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace RosettaStone
+{
+class Entity;
+
+//! \brief An enumerator for identifying the part of the hash that an entity
+//! is added to.
+enum class HashScope
+{
+    NONE,    //!< The entity is not added to the hash.
+    PUBLIC,  //!< The entity is visible to both players.
+    HAND,    //!< The entity is in hand, so only its owner can see it.
+    DECK,    //!< The entity is in deck, so only the number of it is known.
+    SECRET,  //!< The entity is a secret, so only its owner can see it.
+};
+
+//!
+//! \brief HashEntry struct.
+//!
+//! This struct records the value that an entity added to the hash, so it can
+//! be removed exactly even if the game tags of the entity have changed since.
+//!
+struct HashEntry
+{
+    HashScope scope = HashScope::NONE;
+    std::size_t playerIdx = 0;
+    std::uint64_t value = 0;
+};
+
+//!
+//! \brief ZobristHash class.
+//!
+//! This class keeps the hash of the game state incrementally. Each entity in
+//! play, hand, deck or secret zone and each player adds a mixed value of its
+//! card and the game tags that the reduced board view can see to the hash,
+//! and the value is replaced whenever a game tag is set. The information
+//! that is hidden from a player (the cards in hand and the secrets of the
+//! opponent, and the cards in each deck) is kept apart or added only as a
+//! count, so the hash for each player doesn't depend on it. Values are
+//! combined by addition, so the hash doesn't depend on the order in which
+//! they are added. Boards that have the same hash may still differ, so the
+//! users of the hash compare the reduced board views as well.
+//!
+class ZobristHash
+{
+ public:
+    //! Adds \p entity to the hash according to its zone type. It does
+    //! nothing if the entity is not in play, hand, deck or secret zone.
+    //! \param entity The entity to add.
+    void AddEntity(Entity& entity);
+
+    //! Removes \p entity from the hash. It does nothing if the entity has not
+    //! been added.
+    //! \param entity The entity to remove.
+    void RemoveEntity(Entity& entity);
+
+    //! Replaces the value that the game tags of the player added to the hash.
+    //! \param playerType The player type of the player.
+    //! \param prevTagHash The hash of the game tags before they are changed.
+    //! \param tagHash The hash of the game tags after they are changed.
+    void UpdatePlayer(PlayerType playerType, std::uint64_t prevTagHash,
+                      std::uint64_t tagHash);
+
+    //! Returns the hash of the game state that \p viewer can see.
+    //! \param viewer The player who views the game state.
+    //! \param turn The turn of the game.
+    //! \param current The player type of the current player.
+    //! \return The hash of the game state for the player.
+    std::uint64_t GetHash(PlayerType viewer, int turn,
+                          PlayerType current) const;
+
+    //! Removes \p entity from the hash of the game that it belongs to.
+    //! \param entity The entity to remove.
+    static void Detach(Entity& entity);
+
+ private:
+    std::uint64_t m_public = 0;
+    std::array<std::uint64_t, 2> m_hidden{};
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_ZOBRIST_HASH_HPP
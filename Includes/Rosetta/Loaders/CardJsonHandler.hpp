@@ -0,0 +1,128 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_CARD_JSON_HANDLER_HPP
+#define ROSETTASTONE_CARD_JSON_HANDLER_HPP
+
+#include <Rosetta/Cards/Card.hpp>
+
+#include <json/json.hpp>
+
+#include <string>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief CardJsonHandler class.
+//!
+//! This class is a SAX handler that fills cards field by field while
+//! cards.json is parsed, so the whole JSON document is never built in memory.
+//! Placeholder cards are skipped as soon as their id is read.
+//!
+class CardJsonHandler : public nlohmann::json_sax<nlohmann::json>
+{
+ public:
+    //! Constructs card JSON handler with given \p cards.
+    //! \param cards Data storage to store parsed cards.
+    explicit CardJsonHandler(std::vector<Card*>& cards);
+
+    //! Destructor.
+    ~CardJsonHandler() override;
+
+    //! Deleted copy constructor.
+    CardJsonHandler(const CardJsonHandler&) = delete;
+
+    //! Deleted move constructor.
+    CardJsonHandler(CardJsonHandler&&) = delete;
+
+    //! Deleted copy assignment operator.
+    CardJsonHandler& operator=(const CardJsonHandler&) = delete;
+
+    //! Deleted move assignment operator.
+    CardJsonHandler& operator=(CardJsonHandler&&) = delete;
+
+    //! Handles a null value.
+    //! \return true to continue parsing.
+    bool null() override;
+
+    //! Handles a boolean value.
+    //! \param val The boolean value.
+    //! \return true to continue parsing.
+    bool boolean(bool val) override;
+
+    //! Handles an integer value.
+    //! \param val The integer value.
+    //! \return true to continue parsing.
+    bool number_integer(number_integer_t val) override;
+
+    //! Handles an unsigned integer value.
+    //! \param val The unsigned integer value.
+    //! \return true to continue parsing.
+    bool number_unsigned(number_unsigned_t val) override;
+
+    //! Handles a floating-point value.
+    //! \param val The floating-point value.
+    //! \param s The raw token value.
+    //! \return true to continue parsing.
+    bool number_float(number_float_t val, const string_t& s) override;
+
+    //! Handles a string value.
+    //! \param val The string value.
+    //! \return true to continue parsing.
+    bool string(string_t& val) override;
+
+    //! Handles the beginning of an object.
+    //! \param elements The number of object elements, or -1 if unknown.
+    //! \return true to continue parsing.
+    bool start_object(std::size_t elements) override;
+
+    //! Handles an object key.
+    //! \param val The object key.
+    //! \return true to continue parsing.
+    bool key(string_t& val) override;
+
+    //! Handles the end of an object.
+    //! \return true to continue parsing.
+    bool end_object() override;
+
+    //! Handles the beginning of an array.
+    //! \param elements The number of array elements, or -1 if unknown.
+    //! \return true to continue parsing.
+    bool start_array(std::size_t elements) override;
+
+    //! Handles the end of an array.
+    //! \return true to continue parsing.
+    bool end_array() override;
+
+    //! Handles a parse error.
+    //! \param position The position in the input where the error occurs.
+    //! \param lastToken The last read token.
+    //! \param ex The exception object that describes the error.
+    //! \return It doesn't return because it throws an exception.
+    bool parse_error(std::size_t position, const std::string& lastToken,
+                     const nlohmann::detail::exception& ex) override;
+
+ private:
+    //! Sets the integer value of the current key to the current card.
+    //! \param value The integer value.
+    void SetValue(int value);
+
+    //! Sets the string value of the current key to the current card.
+    //! \param value The string value.
+    void SetValue(std::string& value);
+
+    std::vector<Card*>& m_cards;
+
+    Card* m_card = nullptr;
+    std::string m_key;
+    std::string m_innerKey;
+    std::size_t m_depth = 0;
+    bool m_isSkipped = false;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_CARD_JSON_HANDLER_HPP
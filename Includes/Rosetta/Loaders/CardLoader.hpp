@@ -11,6 +11,8 @@
 
 #include <json/json.hpp>
 
+#include <cstdint>
+#include <string>
 #include <vector>
 
 namespace RosettaStone
@@ -18,14 +20,55 @@ namespace RosettaStone
 //!
 //! \brief CardLoader class.
 //!
-//! This class loads card data from cards.json.
+//! This class loads card data from cards.bin or cards.json. cards.bin is the
+//! compact binary card data that is compiled from cards.json by RosettaTool.
+//! cards.bin records the size and the modification time of cards.json that it
+//! is compiled from. If cards.bin doesn't exist, its version is different or
+//! cards.json has changed since, cards.json is used instead. cards.bin is
+//! never written while loading, so a stale one is left to RosettaTool.
 //!
 class CardLoader
 {
  public:
-    //! Loads card data from cards.json.
+    //! Loads card data from cards.bin, or from cards.json if cards.bin can't
+    //! be used.
     //! \param cards Data storage to store added cards with power.
     static void Load(std::vector<Card*>& cards);
+
+    //! Loads card data from JSON file.
+    //! \param path The path of JSON file.
+    //! \param cards Data storage to store added cards with power.
+    static void LoadFromJson(const std::string& path,
+                             std::vector<Card*>& cards);
+
+    //! Loads card data from binary file by memory-mapping it.
+    //! \param path The path of binary file.
+    //! \param jsonPath The path of JSON file that binary file is compiled from.
+    //! \param cards Data storage to store added cards with power.
+    //! \return true if card data is loaded, and false if the file doesn't
+    //! exist, is not valid or doesn't match the JSON file. If the JSON file
+    //! doesn't exist, it is not checked.
+    static bool LoadFromBinary(const std::string& path,
+                               const std::string& jsonPath,
+                               std::vector<Card*>& cards);
+
+    //! Saves card data to binary file. It writes a temporary file and renames
+    //! it to \p path, so readers of \p path never see a partial file.
+    //! \param path The path of binary file.
+    //! \param jsonPath The path of JSON file that card data is loaded from.
+    //! \param cards Card data to save.
+    static void SaveToBinary(const std::string& path,
+                             const std::string& jsonPath,
+                             const std::vector<Card*>& cards);
+
+ private:
+    //! Reads the size and the modification time of the file.
+    //! \param path The path of the file.
+    //! \param size The size of the file.
+    //! \param modifiedTime The modification time of the file.
+    //! \return true if the file exists, and false otherwise.
+    static bool ReadStamp(const std::string& path, std::int64_t& size,
+                          std::int64_t& modifiedTime);
 };
 }  // namespace RosettaStone
 
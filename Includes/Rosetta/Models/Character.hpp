@@ -125,6 +125,12 @@ class Character : public Entity
 
     std::function<void(Player*, Entity*)> afterAttackTrigger;
     std::function<void(Player*, Entity*)> preDamageTrigger;
+
+ protected:
+    //! Constructs character by copying the values of \p prototype.
+    //! \param prototype The character to copy the values.
+    //! \param _owner The owner of the card.
+    Character(const Character& prototype, Player& _owner);
 };
 }  // namespace RosettaStone
 
@@ -48,6 +48,11 @@ class Enchantment : public Entity
     //! Deleted move assignment operator.
     Enchantment& operator=(Enchantment&&) noexcept = delete;
 
+    //! Creates a copy of this enchantment that is owned by \p _owner.
+    //! \param _owner The owner of the copied enchantment.
+    //! \return A pointer to entity that is allocated dynamically.
+    Entity* Clone(Player& _owner) const override;
+
     //! Creates and adds a new Enchantment to the given player's game.
     //! \param player The controller of the enchantment.
     //! \param card The card from which the enchantment must be derived.
@@ -59,9 +64,19 @@ class Enchantment : public Entity
     //! \return The target of enchantment.
     Entity* GetTarget() const;
 
+    //! Sets the target of enchantment.
+    //! \param target The target of enchantment.
+    void SetTarget(Entity* target);
+
     //! Removes enchantment.
     void Remove();
 
+ protected:
+    //! Constructs enchantment by copying the values of \p prototype.
+    //! \param prototype The enchantment to copy the values.
+    //! \param _owner The owner of the card.
+    Enchantment(const Enchantment& prototype, Player& _owner);
+
  private:
     Entity* m_target = nullptr;
 };
@@ -8,8 +8,11 @@
 #define ROSETTASTONE_ENTITY_HPP
 
 #include <Rosetta/Cards/Card.hpp>
+#include <Rosetta/Commons/Arena.hpp>
+#include <Rosetta/Commons/GameTagStorage.hpp>
 #include <Rosetta/Enchants/AuraEffects.hpp>
 #include <Rosetta/Enums/TaskEnums.hpp>
+#include <Rosetta/Games/ZobristHash.hpp>
 #include <Rosetta/Zones/IZone.hpp>
 
 #include <array>
@@ -29,7 +32,7 @@ class Player;
 //! visible or invisible objects in a RosettaStone.
 //! An entity is defined as a collection of properties, called GameTags.
 //!
-class Entity
+class Entity : public ArenaObject
 {
  public:
     //! Default constructor.
@@ -70,6 +73,10 @@ class Entity
     //! \param value The value to set for game tag.
     virtual void SetGameTag(GameTag tag, int value);
 
+    //! Returns the hash of the game tags that are set to the entity.
+    //! \return The hash of the game tags.
+    std::uint64_t GetGameTagHash() const;
+
     //! Returns the value of zone type.
     //! \return The value of zone type.
     ZoneType GetZoneType() const;
@@ -137,6 +144,13 @@ class Entity
     void ActivateTask(PowerType type, Entity* target = nullptr,
                       int chooseOne = 0, Entity* chooseBase = nullptr);
 
+    //! Creates a copy of this entity that is owned by \p _owner.
+    //! NOTE: Pointers to other entities, auras and triggers are not copied.
+    //! They should be remapped by the caller (see Game::Clone()).
+    //! \param _owner The owner of the copied entity.
+    //! \return A pointer to entity that is allocated dynamically.
+    virtual Entity* Clone(Player& _owner) const;
+
     //! Builds a new entity that can be added to a game.
     //! \param player An owner of the entity.
     //! \param card The card from which the entity must be derived.
@@ -166,8 +180,15 @@ class Entity
 
     bool isDestroyed = false;
 
+    HashEntry hashEntry;
+
  protected:
-    std::map<GameTag, int> m_gameTags;
+    //! Constructs entity by copying the values of \p prototype.
+    //! \param prototype The entity to copy the values.
+    //! \param _owner The owner of the entity.
+    Entity(const Entity& prototype, Player& _owner);
+
+    GameTagStorage m_gameTags;
 };
 }  // namespace RosettaStone
 
@@ -46,6 +46,11 @@ class Hero : public Character
     //! Deleted move assignment operator.
     Hero& operator=(Hero&&) noexcept = delete;
 
+    //! Creates a copy of this hero that is owned by \p _owner.
+    //! \param _owner The owner of the copied hero.
+    //! \return A pointer to entity that is allocated dynamically.
+    Entity* Clone(Player& _owner) const override;
+
     //! Returns the value of attack.
     //! \return The value of attack.
     int GetAttack() const override;
@@ -77,6 +82,12 @@ class Hero : public Character
     Weapon* weapon = nullptr;
 
     int fatigue = 0;
+
+ protected:
+    //! Constructs hero by copying the values of \p prototype.
+    //! \param prototype The hero to copy the values.
+    //! \param _owner The owner of the card.
+    Hero(const Hero& prototype, Player& _owner);
 };
 }  // namespace RosettaStone
 
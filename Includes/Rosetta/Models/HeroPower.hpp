@@ -42,6 +42,17 @@ class HeroPower : public Entity
 
     //! Deleted move assignment operator.
     HeroPower& operator=(HeroPower&&) noexcept = delete;
+
+    //! Creates a copy of this hero power that is owned by \p _owner.
+    //! \param _owner The owner of the copied hero power.
+    //! \return A pointer to entity that is allocated dynamically.
+    Entity* Clone(Player& _owner) const override;
+
+ protected:
+    //! Constructs hero power by copying the values of \p prototype.
+    //! \param prototype The hero power to copy the values.
+    //! \param _owner The owner of the card.
+    HeroPower(const HeroPower& prototype, Player& _owner);
 };
 }  // namespace RosettaStone
 
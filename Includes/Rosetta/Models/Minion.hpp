@@ -43,6 +43,11 @@ class Minion : public Character
     //! Deleted move assignment operator.
     Minion& operator=(Minion&&) noexcept = delete;
 
+    //! Creates a copy of this minion that is owned by \p _owner.
+    //! \param _owner The owner of the copied minion.
+    //! \return A pointer to entity that is allocated dynamically.
+    Entity* Clone(Player& _owner) const override;
+
     //! Returns the value of last board position.
     //! \return The value of last board position.
     int GetLastBoardPos() const;
@@ -60,6 +65,12 @@ class Minion : public Character
 
     //! Destroys minion.
     void Destroy() override;
+
+ protected:
+    //! Constructs minion by copying the values of \p prototype.
+    //! \param prototype The minion to copy the values.
+    //! \param _owner The owner of the card.
+    Minion(const Minion& prototype, Player& _owner);
 };
 }  // namespace RosettaStone
 
@@ -8,6 +8,7 @@
 #define ROSETTASTONE_PLAYER_HPP
 
 #include <Rosetta/Commons/Constants.hpp>
+#include <Rosetta/Commons/GameTagStorage.hpp>
 #include <Rosetta/Models/Choice.hpp>
 #include <Rosetta/Models/Entity.hpp>
 #include <Rosetta/Models/Hero.hpp>
@@ -18,6 +19,7 @@
 #include <Rosetta/Zones/SecretZone.hpp>
 #include <Rosetta/Zones/SetasideZone.hpp>
 
+#include <functional>
 #include <string>
 
 namespace RosettaStone
@@ -60,6 +62,13 @@ class Player
     //! \param rhs The source to copy the content.
     void RefCopy(const Player& rhs);
 
+    //! Copies the contents from \p rhs. Zones and hero are filled with the
+    //! clones of the entities of \p rhs.
+    //! \param rhs The source to copy the content.
+    //! \param cloneEntity The function that returns the clone of an entity.
+    void CopyFrom(const Player& rhs,
+                  const std::function<Entity*(const Entity*)>& cloneEntity);
+
     //! Returns a pointer to game.
     //! \return A pointer to game.
     Game* GetGame() const;
@@ -68,6 +77,10 @@ class Player
     //! \param game A pointer to game.
     void SetGame(Game* game);
 
+    //! Returns a pointer to the arena of game.
+    //! \return A pointer to the arena of game, or nullptr if there is no game.
+    Arena* GetArena() const;
+
     //! Returns player's field zone.
     //! \return Player's field zone.
     FieldZone& GetFieldZone() const;
@@ -206,7 +219,7 @@ class Player
     Hero* m_hero = nullptr;
     Game* m_game = nullptr;
 
-    std::map<GameTag, int> m_gameTags;
+    GameTagStorage m_gameTags;
 };
 }  // namespace RosettaStone
 
@@ -43,6 +43,11 @@ class Spell : public Entity
     //! Deleted move assignment operator.
     Spell& operator=(Spell&&) noexcept = delete;
 
+    //! Creates a copy of this spell that is owned by \p _owner.
+    //! \param _owner The owner of the copied spell.
+    //! \return A pointer to entity that is allocated dynamically.
+    Entity* Clone(Player& _owner) const override;
+
     //! Returns whether spell is secret.
     //! \return Whether spell is secret.
     bool IsSecret() const;
@@ -50,6 +55,12 @@ class Spell : public Entity
     //! Returns whether spell is countered.
     //! \return Whether spell is countered.
     bool IsCountered() const;
+
+ protected:
+    //! Constructs spell by copying the values of \p prototype.
+    //! \param prototype The spell to copy the values.
+    //! \param _owner The owner of the card.
+    Spell(const Spell& prototype, Player& _owner);
 };
 }  // namespace RosettaStone
 
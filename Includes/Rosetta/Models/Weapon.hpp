@@ -45,6 +45,11 @@ class Weapon : public Entity
     //! Deleted move assignment operator.
     Weapon& operator=(Weapon&&) noexcept = delete;
 
+    //! Creates a copy of this weapon that is owned by \p _owner.
+    //! \param _owner The owner of the copied weapon.
+    //! \return A pointer to entity that is allocated dynamically.
+    Entity* Clone(Player& _owner) const override;
+
     //! Returns the value of attack.
     //! \return The value of attack.
     int GetAttack() const;
@@ -60,6 +65,12 @@ class Weapon : public Entity
     //! Sets the value of durability.
     //! \param durability The value of durability.
     void SetDurability(int durability);
+
+ protected:
+    //! Constructs weapon by copying the values of \p prototype.
+    //! \param prototype The weapon to copy the values.
+    //! \param _owner The owner of the card.
+    Weapon(const Weapon& prototype, Player& _owner);
 };
 }  // namespace RosettaStone
 
@@ -32,9 +32,12 @@
 #include <Rosetta/CardSets/HoFCardsGen.hpp>
 #include <Rosetta/Cards/Card.hpp>
 #include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Commons/Arena.hpp>
 #include <Rosetta/Commons/Constants.hpp>
 #include <Rosetta/Commons/DeckCode.hpp>
+#include <Rosetta/Commons/GameTagStorage.hpp>
 #include <Rosetta/Commons/Macros.hpp>
+#include <Rosetta/Commons/Random.hpp>
 #include <Rosetta/Commons/SpinLocks.hpp>
 #include <Rosetta/Commons/Utils.hpp>
 #include <Rosetta/Conditions/RelaCondition.hpp>
@@ -55,11 +58,13 @@
 #include <Rosetta/Enums/GameEnums.hpp>
 #include <Rosetta/Enums/TaskEnums.hpp>
 #include <Rosetta/Enums/TriggerEnums.hpp>
+#include <Rosetta/Games/BatchRunner.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Games/GameConfig.hpp>
 #include <Rosetta/Games/GameManager.hpp>
 #include <Rosetta/Games/TriggerManager.hpp>
 #include <Rosetta/Loaders/AccountLoader.hpp>
+#include <Rosetta/Loaders/CardJsonHandler.hpp>
 #include <Rosetta/Loaders/CardLoader.hpp>
 #include <Rosetta/Loaders/PowerLoader.hpp>
 #include <Rosetta/Models/Character.hpp>
@@ -129,6 +134,7 @@
 #include <Rosetta/Tasks/SimpleTasks/TransformTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/WeaponTask.hpp>
 #include <Rosetta/Tasks/TaskMeta.hpp>
+#include <Rosetta/Tasks/TaskProfiler.hpp>
 #include <Rosetta/Tasks/TaskQueue.hpp>
 #include <Rosetta/Tasks/TaskStack.hpp>
 #include <Rosetta/Tasks/TaskStatus.hpp>
@@ -7,6 +7,7 @@
 #ifndef ROSETTASTONE_ITASK_HPP
 #define ROSETTASTONE_ITASK_HPP
 
+#include <Rosetta/Commons/Arena.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Tasks/TaskMeta.hpp>
 #include <Rosetta/Tasks/TaskStatus.hpp>
@@ -19,7 +20,7 @@ namespace RosettaStone
 //! This class is interface of various task classes.
 //! All classes that inherit from it must implement GetTaskID and Impl methods.
 //!
-class ITask
+class ITask : public ArenaObject
 {
  public:
     template <typename T>
@@ -63,14 +64,26 @@ class ITask
     //! \return Entity type.
     EntityType GetEntityType() const;
 
+    //! Returns the player.
+    //! \return The player to run task.
+    Player* GetPlayer() const;
+
     //! Sets the player.
     //! \param player The player to run task.
     void SetPlayer(Player* player);
 
+    //! Returns the source.
+    //! \return The source.
+    Entity* GetSource() const;
+
     //! Sets the source.
     //! \param source The source.
     void SetSource(Entity* source);
 
+    //! Returns the target.
+    //! \return The target.
+    Entity* GetTarget() const;
+
     //! Sets the target.
     //! \param target The target.
     void SetTarget(Entity* target);
@@ -84,10 +97,12 @@ class ITask
     virtual TaskID GetTaskID() const = 0;
 
     //! Returns the cloned task.
+    //! \param arena The arena to allocate the cloned task, or nullptr to use
+    //! global allocator.
     //! \return The cloned task.
     //! \note This will be used for solving multi-thread issue.
     //! Not to access same elements at same time.
-    ITask* Clone();
+    ITask* Clone(Arena* arena = nullptr);
 
     //! Checks it is freeable task.
     //! \return The flag to indicate that it is freeable task.
@@ -113,8 +128,9 @@ class ITask
     virtual TaskStatus Impl(Player& player) = 0;
 
     //! Internal method of Clone().
+    //! \param arena The arena to allocate the cloned task.
     //! \return The cloned task.
-    virtual ITask* CloneImpl() = 0;
+    virtual ITask* CloneImpl(Arena* arena) = 0;
 };
 
 namespace Task
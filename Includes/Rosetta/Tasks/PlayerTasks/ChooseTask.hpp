@@ -48,8 +48,9 @@ class ChooseTask : public ITask
     TaskStatus Impl(Player& player) override;
 
     //! Internal method of Clone().
+    //! \param arena The arena to allocate the cloned task.
     //! \return The cloned task.
-    ITask* CloneImpl() override;
+    ITask* CloneImpl(Arena* arena) override;
 
     std::vector<std::size_t> m_choices;
 };
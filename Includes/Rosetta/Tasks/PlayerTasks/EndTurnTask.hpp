@@ -31,7 +31,8 @@ class EndTurnTask : public ITask
     //! Returns Clone Of Object (pure virtual).
     //! \returns clone of object.
     //! \this uses for thread safe. not to access same task in multiple threads
-    ITask* CloneImpl() override;
+    //! \param arena The arena to allocate the cloned task.
+    ITask* CloneImpl(Arena* arena) override;
 };
 }  // namespace RosettaStone::PlayerTasks
 
@@ -33,8 +33,9 @@ class HeroPowerTask : public ITask
     TaskStatus Impl(Player& player) override;
 
     //! Internal method of Clone().
+    //! \param arena The arena to allocate the cloned task.
     //! \return The cloned task.
-    ITask* CloneImpl() override;
+    ITask* CloneImpl(Arena* arena) override;
 
     std::string m_cardID;
 };
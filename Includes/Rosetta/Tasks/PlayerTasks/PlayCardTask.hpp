@@ -77,8 +77,9 @@ class PlayCardTask : public ITask
     TaskStatus Impl(Player& player) override;
 
     //! Internal method of Clone().
+    //! \param arena The arena to allocate the cloned task.
     //! \return The cloned task.
-    ITask* CloneImpl() override;
+    ITask* CloneImpl(Arena* arena) override;
 
     int m_fieldPos = -1;
     int m_chooseOne = 0;
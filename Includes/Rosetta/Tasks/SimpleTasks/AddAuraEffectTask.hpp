@@ -34,8 +34,9 @@ class AddAuraEffectTask : public ITask
     TaskStatus Impl(Player& player) override;
 
     //! Internal method of Clone().
+    //! \param arena The arena to allocate the cloned task.
     //! \return The cloned task.
-    ITask* CloneImpl() override;
+    ITask* CloneImpl(Arena* arena) override;
 
     Effect* m_effect = nullptr;
 };
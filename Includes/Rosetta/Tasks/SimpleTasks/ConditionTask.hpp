@@ -51,8 +51,9 @@ class ConditionTask : public ITask
     TaskStatus Impl(Player& player) override;
 
     //! Internal method of Clone().
+    //! \param arena The arena to allocate the cloned task.
     //! \return The cloned task.
-    ITask* CloneImpl() override;
+    ITask* CloneImpl(Arena* arena) override;
 
     std::vector<SelfCondition> m_selfConditions;
     std::vector<RelaCondition> m_relaConditions;
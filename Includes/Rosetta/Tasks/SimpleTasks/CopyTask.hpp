@@ -39,8 +39,9 @@ class CopyTask : public ITask
     TaskStatus Impl(Player& player) override;
 
     //! Internal method of Clone().
+    //! \param arena The arena to allocate the cloned task.
     //! \return The cloned task.
-    ITask* CloneImpl() override;
+    ITask* CloneImpl(Arena* arena) override;
 
     ZoneType m_zoneType = ZoneType::INVALID;
     int m_amount = 0;
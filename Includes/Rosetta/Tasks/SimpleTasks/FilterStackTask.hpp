@@ -41,8 +41,9 @@ class FilterStackTask : public ITask
     TaskStatus Impl(Player& player) override;
 
     //! Internal method of Clone().
+    //! \param arena The arena to allocate the cloned task.
     //! \return The cloned task.
-    ITask* CloneImpl() override;
+    ITask* CloneImpl(Arena* arena) override;
 
     SelfCondition* m_selfCondition = nullptr;
     RelaCondition* m_relaCondition = nullptr;
@@ -34,8 +34,9 @@ class FlagTask : public ITask
     TaskStatus Impl(Player& player) override;
 
     //! Internal method of Clone().
+    //! \param arena The arena to allocate the cloned task.
     //! \return The cloned task.
-    ITask* CloneImpl() override;
+    ITask* CloneImpl(Arena* arena) override;
 
     bool m_flag = true;
     std::vector<ITask*> m_toDoTasks;
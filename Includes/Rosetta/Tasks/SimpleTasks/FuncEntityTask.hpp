@@ -37,8 +37,9 @@ class FuncEntityTask : public ITask
     TaskStatus Impl(Player& player) override;
 
     //! Internal method of Clone().
+    //! \param arena The arena to allocate the cloned task.
     //! \return The cloned task.
-    ITask* CloneImpl() override;
+    ITask* CloneImpl(Arena* arena) override;
 
     std::function<std::vector<Entity*>(std::vector<Entity*>)> m_func;
 };
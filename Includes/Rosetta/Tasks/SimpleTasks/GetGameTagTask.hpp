@@ -38,8 +38,9 @@ class GetGameTagTask : public ITask
     TaskStatus Impl(Player& player) override;
 
     //! Internal method of Clone().
+    //! \param arena The arena to allocate the cloned task.
     //! \return The cloned task.
-    ITask* CloneImpl() override;
+    ITask* CloneImpl(Arena* arena) override;
 
     GameTag m_gameTag = GameTag::INVALID;
     int m_entityIndex = 0;
@@ -44,8 +44,9 @@ class MathSubTask : public ITask
     TaskStatus Impl(Player& player) override;
 
     //! Internal method of Clone().
+    //! \param arena The arena to allocate the cloned task.
     //! \return The cloned task.
-    ITask* CloneImpl() override;
+    ITask* CloneImpl(Arena* arena) override;
 
     GameTag m_gameTag = GameTag::INVALID;
     int m_amount = 0;
@@ -34,9 +34,9 @@ class RandomCardTask : public ITask
     //! \param cardClass The class of card.
     //! \param race The race of card.
     //! \return Card list that fits the criteria.
-    std::vector<Card*> GetCardList(CardType cardType = CardType::INVALID,
-                                  CardClass cardClass = CardClass::INVALID,
-                                  Race race = Race::INVALID);
+    const std::vector<Card*>& GetCardList(
+        CardType cardType = CardType::INVALID,
+        CardClass cardClass = CardClass::INVALID, Race race = Race::INVALID);
 
     //! Processes task logic internally and returns meta data.
     //! \param player The player to run task.
@@ -44,8 +44,9 @@ class RandomCardTask : public ITask
     TaskStatus Impl(Player& player) override;
 
     //! Internal method of Clone().
+    //! \param arena The arena to allocate the cloned task.
     //! \return The cloned task.
-    ITask* CloneImpl() override;
+    ITask* CloneImpl(Arena* arena) override;
 };
 }  // namespace RosettaStone::SimpleTasks
 
@@ -0,0 +1,106 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_TASK_PROFILER_HPP
+#define ROSETTASTONE_TASK_PROFILER_HPP
+
+#include <Rosetta/Enums/TaskEnums.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace RosettaStone
+{
+class Card;
+
+//!
+//! \brief TaskProfile struct.
+//!
+//! This struct holds the statistics of the tasks that are processed.
+//! The time and the allocations include the ones of nested tasks.
+//!
+struct TaskProfile
+{
+    //! Adds the statistics of \p rhs to this profile.
+    //! \param rhs The profile to add.
+    void Add(const TaskProfile& rhs);
+
+    //! The number of calls.
+    std::size_t count = 0;
+
+    //! The cumulative wall time.
+    std::chrono::nanoseconds totalTime{ 0 };
+
+    //! The maximum wall time of a call.
+    std::chrono::nanoseconds maxTime{ 0 };
+
+    //! The number of heap allocations.
+    std::size_t allocations = 0;
+};
+
+//!
+//! \brief TaskProfiler class.
+//!
+//! This class records the statistics of tasks that are processed by
+//! TaskQueue for each task ID and for each card ID of the task source.
+//! It is filled only if RosettaStone is built with BUILD_TASK_PROFILER,
+//! otherwise TaskQueue doesn't touch it and the profiles are always empty.
+//!
+class TaskProfiler
+{
+ public:
+    //! Returns whether the profiler is compiled into the library.
+    //! \return Flag that indicates whether the profiler is compiled in.
+    static bool IsEnabled();
+
+    //! Returns the number of heap allocations of the calling thread. It is
+    //! always 0 if the profiler is not compiled in.
+    //! \return The number of heap allocations of the calling thread.
+    static std::size_t GetNumAllocations();
+
+    //! Records a call of the task.
+    //! \param taskID The ID of the task.
+    //! \param card The card of the task source, or nullptr if it is absent.
+    //! \param time The wall time of the call.
+    //! \param allocations The number of heap allocations of the call.
+    void Record(TaskID taskID, const Card* card, std::chrono::nanoseconds time,
+                std::size_t allocations);
+
+    //! Adds the profiles of \p rhs to this profiler.
+    //! \param rhs The profiler to merge.
+    void Merge(const TaskProfiler& rhs);
+
+    //! Clears all profiles.
+    void Clear();
+
+    //! Returns the profile of the task.
+    //! \param taskID The ID of the task.
+    //! \return The profile of the task.
+    TaskProfile GetTaskProfile(TaskID taskID) const;
+
+    //! Returns the profiles for each card ID of the task source.
+    //! \return The profiles for each card ID.
+    const std::map<std::string, TaskProfile>& GetCardProfiles() const;
+
+    //! Writes the profiles as JSON.
+    //! \param os The output stream.
+    void WriteJson(std::ostream& os) const;
+
+    //! Writes the profiles as CSV.
+    //! \param os The output stream.
+    void WriteCsv(std::ostream& os) const;
+
+ private:
+    std::vector<TaskProfile> m_taskProfiles;
+    std::map<std::string, TaskProfile> m_cardProfiles;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_TASK_PROFILER_HPP
@@ -7,16 +7,24 @@
 #define ROSETTASTONE_TASK_QUEUE_HPP
 
 #include <Rosetta/Tasks/ITask.hpp>
+#include <Rosetta/Tasks/TaskProfiler.hpp>
 
-#include <queue>
-#include <stack>
+#include <map>
+#include <vector>
 
 namespace RosettaStone
 {
+class Game;
+
 //!
 //! \brief TaskQueue class.
 //!
 //! This class stores several tasks into stack to run in order.
+//! The tasks of all events are stored in a single buffer. Each event owns a
+//! frame, the range from the beginning of its tasks to the beginning of the
+//! next frame, and the tasks of the frame on top are processed first.
+//! The buffer and the frames keep their capacity, so processing tasks
+//! doesn't allocate memory once they are grown.
 //!
 class TaskQueue
 {
@@ -24,9 +32,13 @@ class TaskQueue
     //! Default constructor.
     TaskQueue() = default;
 
-    //! Returns the current queue.
-    //! \return The current queue.
-    std::queue<ITask*>& GetCurrentQueue();
+    //! Copies the tasks from \p rhs. Each task is cloned and its player,
+    //! source and target are replaced by the ones of \p game.
+    //! \param rhs The source to copy the tasks.
+    //! \param game The game that owns this task queue.
+    //! \param entities The map of entities to the entities cloned from them.
+    void CopyFrom(const TaskQueue& rhs, Game& game,
+                  const std::map<const Entity*, Entity*>& entities);
 
     //! Returns flag that indicates task queue is empty.
     //! \return Flag that indicates task queue is empty.
@@ -46,12 +58,32 @@ class TaskQueue
     //! \return The result of task processing.
     TaskStatus Process();
 
+    //! Returns the profiler of the tasks that are processed.
+    //! \return The profiler of the tasks.
+    TaskProfiler& GetProfiler();
+
+    //! Returns the profiler of the tasks that are processed.
+    //! \return The profiler of the tasks.
+    const TaskProfiler& GetProfiler() const;
+
  private:
-    std::stack<std::queue<ITask*>> m_eventStack;
-    std::queue<ITask*> m_baseQueue;
+    //! The range of the tasks of an event in the buffer.
+    struct Frame
+    {
+        //! The index of the first task of the frame.
+        std::size_t begin = 0;
+
+        //! The index of the next task to process.
+        std::size_t head = 0;
+    };
+
+    std::vector<ITask*> m_tasks;
+    std::vector<Frame> m_frames = { Frame{} };
 
     ITask* m_currentTask = nullptr;
 
+    TaskProfiler m_profiler;
+
     bool m_eventFlag = false;
 };
 }  // namespace RosettaStone
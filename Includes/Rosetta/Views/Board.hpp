@@ -45,6 +45,10 @@ class Board
     //! \return The reduced board view that is created for the player type.
     ReducedBoardView CreateView() const;
 
+    //! Returns the hash of the game state that the player type can see.
+    //! \return The hash of the game state for the player type.
+    std::uint64_t GetHash() const;
+
     //! Returns the board ref view for the current player.
     //! \return The board ref view for the current player.
     CurrentPlayerBoardRefView GetCurPlayerStateRefView() const;
@@ -98,6 +98,10 @@ class BoardRefView
     //! \return A list of cards in the hand of the current player.
     std::vector<Entity*> GetHandCards() const;
 
+    //! Returns the cards in the hand of the current player without allocating.
+    //! \return A range over the cards in the hand of the current player.
+    EntityRange<Entity> GetAliveHandCards() const;
+
     //! Returns a list of cards in the hand of the opponent player.
     //! \return A list of cards in the hand of the opponent player.
     std::vector<std::pair<Entity*, bool>> GetOpponentHandCards() const;
@@ -111,6 +115,11 @@ class BoardRefView
     //! \return A list of minions in the field of the player.
     std::vector<Minion*> GetMinions(PlayerType playerType) const;
 
+    //! Returns the minions in the field of the player without allocating.
+    //! \param playerType The player type to separate players.
+    //! \return A range over the minions in the field of the player.
+    EntityRange<Minion> GetAliveMinions(PlayerType playerType) const;
+
     //! Returns the number of cards in the deck of the player.
     //! \param playerType The player type to separate players.
     //! \return The number of cards in the deck of the player.
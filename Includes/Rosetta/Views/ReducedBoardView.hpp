@@ -12,6 +12,8 @@
 
 #include <Rosetta/Views/ViewTypes.hpp>
 
+#include <string_view>
+
 namespace RosettaStone
 {
 class BoardRefView;
@@ -23,11 +25,11 @@ class BoardRefView;
 //! is reached via different action orderings, and is also designed to be
 //! storable and hashable The information here should be enough so that
 //! available actions are identical if the reduced board view are identical.
+//! The view is plain data of a fixed size, so it is compared and hashed as raw
+//! memory.
 //!
 class ReducedBoardView
 {
-    friend std::hash<ReducedBoardView>;
-
  public:
     //! Constructs reduced board view with given \p view.
     //! \param view The board ref view.
@@ -61,7 +63,7 @@ class ReducedBoardView
 
     //! Returns the hero of the current player.
     //! \return The hero of the current player.
-    const ViewTypes::MyHero& GetMyHero() const;
+    const ViewTypes::Hero& GetMyHero() const;
 
     //! Returns the hero power of the current player.
     //! \return the hero power of the current player.
@@ -77,7 +79,7 @@ class ReducedBoardView
 
     //! Returns a list of minions in the field of the current player.
     //! \return A list of minions in the field of the current player.
-    const ViewTypes::MyMinions& GetMyMinions() const;
+    const ViewTypes::Minions& GetMyMinions() const;
 
     //! Returns a list of cards in the hand of the current player.
     //! \return A list of cards in the hand of the current player.
@@ -119,11 +121,11 @@ class ReducedBoardView
     int m_turn;
     PlayerType m_playerType;
 
-    ViewTypes::MyHero m_myHero;
+    ViewTypes::Hero m_myHero;
     ViewTypes::HeroPower m_myHeroPower;
     ViewTypes::Weapon m_myWeapon;
     ViewTypes::ManaCrystal m_myManaCrystal;
-    ViewTypes::MyMinions m_myMinions;
+    ViewTypes::Minions m_myMinions;
     ViewTypes::MyHand m_myHand;
     ViewTypes::Deck m_myDeck;
 
@@ -137,37 +139,23 @@ class ReducedBoardView
 };
 }  // namespace RosettaStone
 
+static_assert(std::is_trivially_copyable_v<RosettaStone::ReducedBoardView> &&
+                  std::has_unique_object_representations_v<
+                      RosettaStone::ReducedBoardView>,
+              "ReducedBoardView must be comparable as raw memory.");
+
 namespace std
 {
-using namespace RosettaStone;
-
 //! \brief Template specialization of std::hash for ReducedBoardView.
 template <>
-struct hash<ReducedBoardView>
+struct hash<RosettaStone::ReducedBoardView>
 {
-    std::size_t operator()(const ReducedBoardView& rhs) const noexcept
+    std::size_t operator()(const RosettaStone::ReducedBoardView& rhs) const
+        noexcept
     {
-        std::size_t result = 0;
-        CombineHash(result, rhs.m_turn);
-        CombineHash(result, static_cast<int>(rhs.m_playerType));
-
-        CombineHash(result, rhs.m_myHero);
-        CombineHash(result, rhs.m_myHeroPower);
-        CombineHash(result, rhs.m_myWeapon);
-        CombineHash(result, rhs.m_myManaCrystal);
-        CombineHash(result, rhs.m_myMinions);
-        CombineHash(result, rhs.m_myHand);
-        CombineHash(result, rhs.m_myDeck);
-
-        CombineHash(result, rhs.m_opHero);
-        CombineHash(result, rhs.m_opHeroPower);
-        CombineHash(result, rhs.m_opWeapon);
-        CombineHash(result, rhs.m_opManaCrystal);
-        CombineHash(result, rhs.m_opMinions);
-        CombineHash(result, rhs.m_opHand);
-        CombineHash(result, rhs.m_opDeck);
-
-        return result;
+        return std::hash<std::string_view>()(
+            std::string_view(reinterpret_cast<const char*>(&rhs),
+                             sizeof(RosettaStone::ReducedBoardView)));
     }
 };
 }  // namespace std
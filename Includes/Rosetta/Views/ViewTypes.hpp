@@ -7,143 +7,135 @@
 #ifndef ROSETTASTONE_VIEW_TYPES_HPP
 #define ROSETTASTONE_VIEW_TYPES_HPP
 
+#include <Rosetta/Commons/Constants.hpp>
 #include <Rosetta/Commons/Utils.hpp>
 #include <Rosetta/Models/Hero.hpp>
 #include <Rosetta/Models/HeroPower.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Models/Weapon.hpp>
 
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+//! NOTE: The structs in this file are plain data without padding bytes. The
+//! padding is declared explicitly as 'reserved' members that are always zero,
+//! so two views of the same board are identical byte by byte and can be
+//! compared with memcmp and hashed as raw memory.
 namespace RosettaStone::ViewTypes
 {
-//! This struct contains information of hero.
-//! Note that this struct is used for the board view.
-struct Hero
+//!
+//! \brief FixedList class.
+//!
+//! This class stores up to \p N elements in place. The unused elements stay
+//! value-initialized, so two lists with the same elements are identical byte
+//! by byte.
+//!
+template <typename T, std::size_t N>
+class FixedList
 {
-    int attack = 0;
-    int health = 0;
-    int armor = 0;
-    bool isStealth = false;
-    bool isImmune = false;
+ public:
+    //! Appends \p value to the end of the list. It is ignored if the list is
+    //! full.
+    //! \param value The value to append.
+    void push_back(const T& value)
+    {
+        if (m_count < static_cast<int>(N))
+        {
+            m_items[m_count++] = value;
+        }
+    }
 
-    void Fill(const RosettaStone::Hero& hero)
+    //! Returns the number of elements in the list.
+    //! \return The number of elements in the list.
+    std::size_t size() const
     {
-        attack = hero.GetAttack();
-        health = hero.GetHealth();
-        armor = hero.GetArmor();
-        isStealth = (hero.GetGameTag(GameTag::STEALTH) == 1);
-        isImmune = (hero.GetGameTag(GameTag::IMMUNE) == 1);
+        return static_cast<std::size_t>(m_count);
     }
 
-    bool operator==(const Hero& rhs) const
+    //! Returns whether the list is empty.
+    //! \return Whether the list is empty.
+    bool empty() const
     {
-        if (attack != rhs.attack)
-        {
-            return false;
-        }
-        if (health != rhs.health)
-        {
-            return false;
-        }
-        if (armor != rhs.armor)
-        {
-            return false;
-        }
-        if (isStealth != rhs.isStealth)
-        {
-            return false;
-        }
-        if (isImmune != rhs.isImmune)
-        {
-            return false;
-        }
+        return m_count == 0;
+    }
+
+    //! Operator overloading: operator[].
+    const T& operator[](std::size_t idx) const
+    {
+        return m_items[idx];
+    }
 
-        return true;
+    //! Returns an iterator to the first element.
+    //! \return An iterator to the first element.
+    const T* begin() const
+    {
+        return m_items.data();
     }
 
-    bool operator!=(const Hero& rhs) const
+    //! Returns an iterator past the last element.
+    //! \return An iterator past the last element.
+    const T* end() const
     {
-        return !(*this == rhs);
+        return m_items.data() + m_count;
     }
+
+ private:
+    std::array<T, N> m_items{};
+    int m_count = 0;
 };
 
-//! This struct contains information of hero for the current player.
-//! Note that this struct inherits from Hero struct.
+//! This struct contains information of hero.
 //! Note that this struct is used for the board view.
-struct MyHero : public Hero
+struct Hero
 {
+    int attack = 0;
+    int health = 0;
+    int armor = 0;
+    bool isStealth = false;
+    bool isImmune = false;
     bool attackable = false;
+    std::uint8_t reserved[1] = {};
 
     void Fill(const RosettaStone::Hero& hero, bool _attackable)
     {
-        Hero::Fill(hero);
+        attack = hero.GetAttack();
+        health = hero.GetHealth();
+        armor = hero.GetArmor();
+        isStealth = (hero.GetGameTag(GameTag::STEALTH) == 1);
+        isImmune = (hero.GetGameTag(GameTag::IMMUNE) == 1);
         attackable = _attackable;
     }
-
-    bool operator==(const MyHero& rhs) const
-    {
-        if (Hero::operator!=(rhs))
-        {
-            return false;
-        }
-        if (attackable != rhs.attackable)
-        {
-            return false;
-        }
-
-        return true;
-    }
-
-    bool operator!=(const MyHero& rhs) const
-    {
-        return !(*this == rhs);
-    }
 };
 
 //! This struct contains information of hero power.
 //! Note that this struct is used for the board view.
 struct HeroPower
 {
-    std::string cardID;
+    int dbfID = 0;
     bool isExhausted = false;
+    std::uint8_t reserved[3] = {};
 
     void Fill(RosettaStone::HeroPower& power)
     {
-        cardID = power.card->id;
+        dbfID = power.card->dbfID;
         isExhausted = power.IsExhausted();
     }
-
-    bool operator==(const HeroPower& rhs) const
-    {
-        if (cardID != rhs.cardID)
-        {
-            return false;
-        }
-        if (isExhausted != rhs.isExhausted)
-        {
-            return false;
-        }
-
-        return true;
-    }
-
-    bool operator!=(const HeroPower& rhs) const
-    {
-        return !(*this == rhs);
-    }
 };
 
 //! This struct contains information of weapon.
 //! Note that this struct is used for the board view.
 struct Weapon
 {
-    std::string cardID;
+    int dbfID = 0;
     int attack = 0;
     int durability = 0;
     bool isEquipped = false;
+    std::uint8_t reserved[3] = {};
 
     void Fill(const RosettaStone::Weapon& weapon)
     {
-        cardID = weapon.card->id;
+        dbfID = weapon.card->dbfID;
         attack = weapon.GetAttack();
         durability = weapon.GetDurability();
         isEquipped = true;
@@ -151,38 +143,7 @@ struct Weapon
 
     void Invalidate()
     {
-        isEquipped = false;
-    }
-
-    bool operator==(const Weapon& rhs) const
-    {
-        if (isEquipped != rhs.isEquipped)
-        {
-            return false;
-        }
-
-        if (isEquipped)
-        {
-            if (cardID != rhs.cardID)
-            {
-                return false;
-            }
-            if (attack != rhs.attack)
-            {
-                return false;
-            }
-            if (durability != rhs.durability)
-            {
-                return false;
-            }
-        }
-
-        return true;
-    }
-
-    bool operator!=(const Weapon& rhs) const
-    {
-        return !(*this == rhs);
+        *this = Weapon();
     }
 };
 
@@ -202,40 +163,13 @@ struct ManaCrystal
         overloadOwed = player.GetOverloadOwed();
         overloadLocked = player.GetOverloadLocked();
     }
-
-    bool operator==(const ManaCrystal& rhs) const
-    {
-        if (remaining != rhs.remaining)
-        {
-            return false;
-        }
-        if (total != rhs.total)
-        {
-            return false;
-        }
-        if (overloadOwed != rhs.overloadOwed)
-        {
-            return false;
-        }
-        if (overloadLocked != rhs.overloadLocked)
-        {
-            return false;
-        }
-
-        return true;
-    }
-
-    bool operator!=(const ManaCrystal& rhs) const
-    {
-        return !(*this == rhs);
-    }
 };
 
 //! This struct contains information of minion.
 //! Note that this struct is used for the board view.
 struct Minion
 {
-    std::string cardID;
+    int dbfID = 0;
     int attack = 0;
     int health = 0;
     bool isSilenced = false;
@@ -243,10 +177,12 @@ struct Minion
     bool cantAttackHero = false;
     bool isStealth = false;
     bool isImmune = false;
+    bool attackable = false;
+    std::uint8_t reserved[2] = {};
 
-    void Fill(const RosettaStone::Minion& minion)
+    void Fill(const RosettaStone::Minion& minion, bool _attackable)
     {
-        cardID = minion.card->id;
+        dbfID = minion.card->dbfID;
         attack = minion.GetAttack();
         health = minion.GetHealth();
         isSilenced = (minion.GetGameTag(GameTag::SILENCED) == 1);
@@ -255,152 +191,36 @@ struct Minion
             (minion.GetGameTag(GameTag::CANNOT_ATTACK_HEROES) == 1);
         isStealth = (minion.GetGameTag(GameTag::STEALTH) == 1);
         isImmune = (minion.GetGameTag(GameTag::IMMUNE) == 1);
-    }
-
-    bool operator==(const Minion& rhs) const
-    {
-        if (cardID != rhs.cardID)
-        {
-            return false;
-        }
-        if (attack != rhs.attack)
-        {
-            return false;
-        }
-        if (health != rhs.health)
-        {
-            return false;
-        }
-        if (isSilenced != rhs.isSilenced)
-        {
-            return false;
-        }
-        if (hasTaunt != rhs.hasTaunt)
-        {
-            return false;
-        }
-        if (cantAttackHero != rhs.cantAttackHero)
-        {
-            return false;
-        }
-        if (isStealth != rhs.isStealth)
-        {
-            return false;
-        }
-        if (isImmune != rhs.isImmune)
-        {
-            return false;
-        }
-
-        return true;
-    }
-
-    bool operator!=(const Minion& rhs) const
-    {
-        return !(*this == rhs);
-    }
-};
-
-//! This struct contains information of minion for the current player.
-//! Note that this struct inherits from Minion struct.
-//! Note that this struct is used for the board view.
-struct MyMinion : public Minion
-{
-    bool attackable = false;
-
-    void Fill(const RosettaStone::Minion& minion, bool _attackable)
-    {
-        Minion::Fill(minion);
         attackable = _attackable;
     }
-
-    bool operator==(const MyMinion& rhs) const
-    {
-        if (Minion::operator!=(rhs))
-        {
-            return false;
-        }
-        if (attackable != rhs.attackable)
-        {
-            return false;
-        }
-
-        return true;
-    }
-
-    bool operator!=(const MyMinion& rhs) const
-    {
-        return !(*this == rhs);
-    }
 };
 
-using Minions = std::vector<Minion>;
-using MyMinions = std::vector<MyMinion>;
+using Minions = FixedList<Minion, MAX_FIELD_SIZE>;
 
 //! This struct contains information of the hand cards for the current player.
 //! Note that this struct is used for the board view.
 struct MyHandCard
 {
-    std::string cardID;
+    int dbfID = 0;
     int cost = 0;
     int attack = 0;
     int health = 0;
 
     void Fill(RosettaStone::Entity& entity)
     {
-        cardID = entity.card->id;
+        dbfID = entity.card->dbfID;
         cost = entity.GetCost();
         attack = entity.GetGameTag(GameTag::ATK);
         health = entity.GetGameTag(GameTag::HEALTH);
     }
-
-    bool operator==(const MyHandCard& rhs) const
-    {
-        if (cardID != rhs.cardID)
-        {
-            return false;
-        }
-        if (cost != rhs.cost)
-        {
-            return false;
-        }
-        if (attack != rhs.attack)
-        {
-            return false;
-        }
-        if (health != rhs.health)
-        {
-            return false;
-        }
-
-        return true;
-    }
-
-    bool operator!=(const MyHandCard& rhs) const
-    {
-        return !(*this == rhs);
-    }
 };
 
+using MyHand = FixedList<MyHandCard, MAX_HAND_SIZE>;
+
 //! This struct contains information of the hand cards for the opponent player.
+//! Only the number of cards is visible to the current player.
 //! Note that this struct is used for the board view.
-struct OpHandCard
-{
-    bool operator==([[maybe_unused]] const OpHandCard& rhs) const
-    {
-        return true;
-    }
-
-    bool operator!=(const OpHandCard& rhs) const
-    {
-        return !(*this == rhs);
-    }
-};
-
-using MyHand = std::vector<MyHandCard>;
-using OpHand = std::vector<OpHandCard>;
-
-struct Deck
+struct OpHand
 {
     int count = 0;
 
@@ -409,254 +229,33 @@ struct Deck
         count = _count;
     }
 
-    bool operator==(const Deck& rhs) const
+    std::size_t size() const
     {
-        return count == rhs.count;
-    }
-
-    bool operator!=(const Deck& rhs) const
-    {
-        return !(*this == rhs);
-    }
-};
-}  // namespace RosettaStone::ViewTypes
-
-namespace std
-{
-//! \brief Template specialization of std::hash for ViewTypes::Hero.
-template <>
-struct hash<RosettaStone::ViewTypes::Hero>
-{
-    std::size_t operator()(const RosettaStone::ViewTypes::Hero& rhs) const
-        noexcept
-    {
-        std::size_t result = 0;
-        CombineHash(result, rhs.attack);
-        CombineHash(result, rhs.health);
-        CombineHash(result, rhs.armor);
-        CombineHash(result, rhs.isStealth);
-        CombineHash(result, rhs.isImmune);
-
-        return result;
+        return static_cast<std::size_t>(count);
     }
 };
 
-//! \brief Template specialization of std::hash for ViewTypes::MyHero.
-template <>
-struct hash<RosettaStone::ViewTypes::MyHero>
-{
-    std::size_t operator()(const RosettaStone::ViewTypes::MyHero& rhs) const
-        noexcept
-    {
-        std::size_t result = std::hash<RosettaStone::ViewTypes::Hero>()(rhs);
-        CombineHash(result, rhs.attackable);
-
-        return result;
-    }
-};
-
-//! \brief Template specialization of std::hash for ViewTypes::HeroPower.
-template <>
-struct hash<RosettaStone::ViewTypes::HeroPower>
-{
-    std::size_t operator()(const RosettaStone::ViewTypes::HeroPower& rhs) const
-        noexcept
-    {
-        std::size_t result = 0;
-        CombineHash(result, rhs.cardID);
-        CombineHash(result, rhs.isExhausted);
-
-        return result;
-    }
-};
-
-//! \brief Template specialization of std::hash for ViewTypes::Weapon.
-template <>
-struct hash<RosettaStone::ViewTypes::Weapon>
-{
-    std::size_t operator()(const RosettaStone::ViewTypes::Weapon& rhs) const
-        noexcept
-    {
-        std::size_t result = 0;
-        CombineHash(result, rhs.isEquipped);
-
-        if (rhs.isEquipped)
-        {
-            CombineHash(result, rhs.cardID);
-            CombineHash(result, rhs.attack);
-            CombineHash(result, rhs.durability);
-        }
-
-        return result;
-    }
-};
-
-//! \brief Template specialization of std::hash for ViewTypes::ManaCrystal.
-template <>
-struct hash<RosettaStone::ViewTypes::ManaCrystal>
-{
-    std::size_t operator()(
-        const RosettaStone::ViewTypes::ManaCrystal& rhs) const noexcept
-    {
-        std::size_t result = 0;
-        CombineHash(result, rhs.remaining);
-        CombineHash(result, rhs.total);
-        CombineHash(result, rhs.overloadOwed);
-        CombineHash(result, rhs.overloadLocked);
-
-        return result;
-    }
-};
-
-//! \brief Template specialization of std::hash for ViewTypes::Minion.
-template <>
-struct hash<RosettaStone::ViewTypes::Minion>
-{
-    std::size_t operator()(const RosettaStone::ViewTypes::Minion& rhs) const
-        noexcept
-    {
-        std::size_t result = 0;
-        CombineHash(result, rhs.cardID);
-        CombineHash(result, rhs.attack);
-        CombineHash(result, rhs.health);
-        CombineHash(result, rhs.isSilenced);
-        CombineHash(result, rhs.hasTaunt);
-        CombineHash(result, rhs.cantAttackHero);
-        CombineHash(result, rhs.isStealth);
-        CombineHash(result, rhs.isImmune);
-
-        return result;
-    }
-};
-
-//! \brief Template specialization of std::hash for ViewTypes::MyMinion.
-template <>
-struct hash<RosettaStone::ViewTypes::MyMinion>
-{
-    std::size_t operator()(const RosettaStone::ViewTypes::MyMinion& rhs) const
-        noexcept
-    {
-        std::size_t result = std::hash<RosettaStone::ViewTypes::Minion>()(rhs);
-        CombineHash(result, rhs.attackable);
-
-        return result;
-    }
-};
-
-//! \brief Template specialization of std::hash for ViewTypes::Minions.
-template <>
-struct hash<RosettaStone::ViewTypes::Minions>
-{
-    std::size_t operator()(const RosettaStone::ViewTypes::Minions& rhs) const
-        noexcept
-    {
-        std::size_t result = 0;
-
-        for (const auto& minion : rhs)
-        {
-            CombineHash(result, minion);
-        }
-
-        return result;
-    }
-};
-
-//! \brief Template specialization of std::hash for ViewTypes::MyMinions.
-template <>
-struct hash<RosettaStone::ViewTypes::MyMinions>
-{
-    std::size_t operator()(const RosettaStone::ViewTypes::MyMinions& rhs) const
-        noexcept
-    {
-        std::size_t result = 0;
-
-        for (const auto& minion : rhs)
-        {
-            CombineHash(result, minion);
-        }
-
-        return result;
-    }
-};
-
-//! \brief Template specialization of std::hash for ViewTypes::MyHandCard.
-template <>
-struct hash<RosettaStone::ViewTypes::MyHandCard>
-{
-    std::size_t operator()(const RosettaStone::ViewTypes::MyHandCard& rhs) const
-        noexcept
-    {
-        std::size_t result = 0;
-        CombineHash(result, rhs.cardID);
-        CombineHash(result, rhs.cost);
-        CombineHash(result, rhs.attack);
-        CombineHash(result, rhs.health);
-
-        return result;
-    }
-};
-
-//! \brief Template specialization of std::hash for ViewTypes::OpHandCard.
-template <>
-struct hash<RosettaStone::ViewTypes::OpHandCard>
-{
-    std::size_t operator()([
-        [maybe_unused]] const RosettaStone::ViewTypes::OpHandCard& rhs) const
-        noexcept
-    {
-        return 0;
-    }
-};
-
-//! \brief Template specialization of std::hash for ViewTypes::MyHand.
-template <>
-struct hash<RosettaStone::ViewTypes::MyHand>
+//! This struct contains information of the deck.
+//! Note that this struct is used for the board view.
+struct Deck
 {
-    std::size_t operator()(const RosettaStone::ViewTypes::MyHand& rhs) const
-        noexcept
-    {
-        std::size_t result = 0;
-
-        for (const auto& entity : rhs)
-        {
-            CombineHash(result, entity);
-        }
-
-        return result;
-    }
-};
+    int count = 0;
 
-//! \brief Template specialization of std::hash for ViewTypes::OpHand.
-template <>
-struct hash<RosettaStone::ViewTypes::OpHand>
-{
-    std::size_t operator()(const RosettaStone::ViewTypes::OpHand& rhs) const
-        noexcept
+    void Fill(int _count)
     {
-        std::size_t result = 0;
-
-        for (const auto& entity : rhs)
-        {
-            CombineHash(result, entity);
-        }
-
-        return result;
+        count = _count;
     }
 };
 
-//! \brief Template specialization of std::hash for ViewTypes::Deck.
-template <>
-struct hash<RosettaStone::ViewTypes::Deck>
-{
-    std::size_t operator()(const RosettaStone::ViewTypes::Deck& rhs) const
-        noexcept
-    {
-        std::size_t result = 0;
-        CombineHash(result, rhs.count);
-
-        return result;
-    }
-};
-}  // namespace std
+static_assert(std::has_unique_object_representations_v<Hero> &&
+                  std::has_unique_object_representations_v<HeroPower> &&
+                  std::has_unique_object_representations_v<Weapon> &&
+                  std::has_unique_object_representations_v<ManaCrystal> &&
+                  std::has_unique_object_representations_v<Minions> &&
+                  std::has_unique_object_representations_v<MyHand> &&
+                  std::has_unique_object_representations_v<OpHand> &&
+                  std::has_unique_object_representations_v<Deck>,
+              "View types must not have padding bytes.");
+}  // namespace RosettaStone::ViewTypes
 
-#endif  // ROSETTASTONE_VIEW_TYPES_HPP
\ No newline at end of file
+#endif  // ROSETTASTONE_VIEW_TYPES_HPP
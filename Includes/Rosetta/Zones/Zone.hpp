@@ -7,6 +7,7 @@
 #define ROSETTASTONE_ZONE_HPP
 
 #include <Rosetta/Enchants/Aura.hpp>
+#include <Rosetta/Games/ZobristHash.hpp>
 #include <Rosetta/Zones/IZone.hpp>
 
 #include <algorithm>
@@ -109,6 +110,8 @@ class UnlimitedZone : public Zone<Entity>
             std::remove(m_entities.begin(), m_entities.end(), &entity),
             m_entities.end());
 
+        ZobristHash::Detach(entity);
+
         return entity;
     }
 
@@ -133,6 +136,96 @@ class UnlimitedZone : public Zone<Entity>
     std::vector<Entity*> m_entities;
 };
 
+//!
+//! \brief EntityRange class.
+//!
+//! This class is a non-owning view over the slots of a zone. It iterates the
+//! entities that are not destroyed without building a new container, so the
+//! zone must not be modified while it is iterated.
+//!
+template <typename T>
+class EntityRange
+{
+ public:
+    //!
+    //! \brief EntityRange::Iterator class.
+    //!
+    //! This class is a forward iterator that skips empty slots and destroyed
+    //! entities.
+    //!
+    class Iterator
+    {
+     public:
+        //! Constructs iterator with given \p cur and \p end.
+        //! \param cur The slot to start from.
+        //! \param end The slot past the last entity.
+        Iterator(T** cur, T** end) : m_cur(cur), m_end(end)
+        {
+            SkipInvalid();
+        }
+
+        //! Operator overloading: operator*.
+        T* const& operator*() const
+        {
+            return *m_cur;
+        }
+
+        //! Operator overloading: operator++ (prefix).
+        Iterator& operator++()
+        {
+            ++m_cur;
+            SkipInvalid();
+
+            return *this;
+        }
+
+        //! Operator overloading: operator!=.
+        bool operator!=(const Iterator& rhs) const
+        {
+            return m_cur != rhs.m_cur;
+        }
+
+     private:
+        void SkipInvalid()
+        {
+            while (m_cur != m_end &&
+                   (*m_cur == nullptr ||
+                    static_cast<bool>((*m_cur)->isDestroyed)))
+            {
+                ++m_cur;
+            }
+        }
+
+        T** m_cur;
+        T** m_end;
+    };
+
+    //! Constructs range with given \p entities and \p count.
+    //! \param entities The slots of the zone.
+    //! \param count The number of slots to iterate.
+    EntityRange(T** entities, int count)
+        : m_begin(entities), m_end(entities + count)
+    {
+        // Do nothing
+    }
+
+    //! Returns an iterator to the first entity that is not destroyed.
+    Iterator begin() const
+    {
+        return Iterator(m_begin, m_end);
+    }
+
+    //! Returns an iterator past the last entity.
+    Iterator end() const
+    {
+        return Iterator(m_end, m_end);
+    }
+
+ private:
+    T** m_begin;
+    T** m_end;
+};
+
 //!
 //! \brief LimitedZone class.
 //!
@@ -211,6 +304,7 @@ class LimitedZone : public Zone<T>
         }
 
         entity.zone = nullptr;
+        ZobristHash::Detach(entity);
 
         if (entity.activatedTrigger != nullptr)
         {
@@ -257,6 +351,13 @@ class LimitedZone : public Zone<T>
         return m_count == m_maxSize;
     }
 
+    //! Returns the entities that are not destroyed without allocating.
+    //! \return A range over the entities that are not destroyed.
+    EntityRange<T> GetAlive() const
+    {
+        return EntityRange<T>(m_entities, m_count);
+    }
+
     virtual std::vector<T*> GetAll()
     {
         std::vector<T*> result;
@@ -331,6 +432,7 @@ class PositioningZone : public LimitedZone<T>
         Reposition(pos);
 
         entity.zone = nullptr;
+        ZobristHash::Detach(entity);
 
         if (entity.activatedTrigger != nullptr)
         {
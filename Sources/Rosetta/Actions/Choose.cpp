@@ -42,7 +42,7 @@ void ChoiceMulligan(Player& player, const std::vector<std::size_t>& choices)
 
             // Collect cards to redraw
             std::vector<Entity*> mulliganList;
-            for (const auto entity : hand.GetAll())
+            for (const auto entity : hand.GetAlive())
             {
                 const bool isExist = std::find(choices.begin(), choices.end(),
                                                entity->id) == choices.end();
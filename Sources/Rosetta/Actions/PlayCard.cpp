@@ -310,7 +310,7 @@ bool IsPlayableByCardReq(Entity* source)
                 auto& entourages = source->card->entourages;
                 std::size_t entourageCount = 0;
 
-                for (auto& minion : curField.GetAll())
+                for (auto& minion : curField.GetAlive())
                 {
                     for (auto& entourage : entourages)
                     {
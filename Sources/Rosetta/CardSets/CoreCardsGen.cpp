@@ -9,6 +9,7 @@
 #include <Rosetta/Conditions/SelfCondition.hpp>
 #include <Rosetta/Enchants/Effects.hpp>
 #include <Rosetta/Enchants/Enchants.hpp>
+#include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/AddEnchantmentTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/AddStackToTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/ArmorTask.hpp>
@@ -39,10 +40,6 @@
 #include <Rosetta/Tasks/SimpleTasks/TransformTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/WeaponTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 using namespace RosettaStone::SimpleTasks;
 
 namespace RosettaStone
@@ -210,7 +207,7 @@ void CoreCardsGen::AddHeroPowers(std::map<std::string, Power>& cards)
     // --------------------------------------------------------
     power.ClearData();
     power.AddPowerTask(new FuncNumberTask([](Entity* entity) {
-        auto minions = entity->owner->GetFieldZone().GetAll();
+        auto minions = entity->owner->GetFieldZone().GetAlive();
         std::vector<Card*> totemCards;
         totemCards.reserve(4);
 
@@ -237,7 +234,8 @@ void CoreCardsGen::AddHeroPowers(std::map<std::string, Power>& cards)
             return;
         }
 
-        const auto idx = Random::get<int>(0, totemCards.size() - 1);
+        const auto idx = entity->owner->GetGame()->random.Get<std::size_t>(
+            0, totemCards.size() - 1);
         Entity* totem =
             Entity::GetFromCard(*entity->owner, totemCards[idx]);
         entity->owner->GetFieldZone().Add(*dynamic_cast<Minion*>(totem));
@@ -3414,7 +3414,7 @@ void Expert1CardsGen::AddNeutralNonCollect(std::map<std::string, Power>& cards)
     // Text: Increased Health.
     // --------------------------------------------------------
     power.ClearData();
-    power.AddEnchant(new Enchant(Effects::HealthN(2)));
+    power.AddEnchant(new Enchant(Effects::HealthN(1)));
     cards.emplace("EX1_004e", power);
 
     // ---------------------------------- ENCHANTMENT - NEUTRAL
@@ -9,14 +9,40 @@
 #include <Rosetta/Loaders/CardLoader.hpp>
 #include <Rosetta/Loaders/PowerLoader.hpp>
 
+#include <algorithm>
+
 namespace RosettaStone
 {
 Card emptyCard;
+const std::vector<Card*> emptyCards;
 std::vector<Card*> Cards::m_cards;
+std::unordered_map<const Card*, std::size_t> Cards::m_cardIndexes;
+std::unordered_map<std::string, Card*> Cards::m_cardsByID;
+std::unordered_map<int, Card*> Cards::m_cardsByDbfID;
+std::unordered_map<std::string, Card*> Cards::m_cardsByName;
+std::map<Rarity, std::vector<Card*>> Cards::m_cardsByRarity;
+std::map<CardClass, std::vector<Card*>> Cards::m_cardsByClass;
+std::map<CardSet, std::vector<Card*>> Cards::m_cardsBySet;
+std::map<CardType, std::vector<Card*>> Cards::m_cardsByType;
+std::map<Race, std::vector<Card*>> Cards::m_cardsByRace;
+std::map<GameTag, std::vector<Card*>> Cards::m_cardsByGameTag;
+std::map<int, std::vector<Card*>> Cards::m_cardsByCost;
+std::map<int, std::vector<Card*>> Cards::m_cardsByAttack;
+std::map<int, std::vector<Card*>> Cards::m_cardsByHealth;
+std::map<int, std::vector<Card*>> Cards::m_cardsBySpellPower;
+std::vector<Card*> Cards::m_collectibleCards;
+std::map<std::tuple<CardType, CardClass, Race>, std::vector<Card*>>
+    Cards::m_randomCardPools;
+std::unordered_map<std::string, std::vector<Card*>> Cards::m_entourageCards;
 
 Cards::Cards()
 {
     CardLoader::Load(m_cards);
+
+    // NOTE: Powers must be loaded after building the indexes because some
+    // tasks find cards in their constructor.
+    BuildIndexes();
+
     PowerLoader::Load(m_cards);
 }
 
@@ -28,6 +54,106 @@ Cards::~Cards()
     }
 
     m_cards.clear();
+    m_cardIndexes.clear();
+    m_cardsByID.clear();
+    m_cardsByDbfID.clear();
+    m_cardsByName.clear();
+    m_cardsByRarity.clear();
+    m_cardsByClass.clear();
+    m_cardsBySet.clear();
+    m_cardsByType.clear();
+    m_cardsByRace.clear();
+    m_cardsByGameTag.clear();
+    m_cardsByCost.clear();
+    m_cardsByAttack.clear();
+    m_cardsByHealth.clear();
+    m_cardsBySpellPower.clear();
+    m_collectibleCards.clear();
+    m_randomCardPools.clear();
+    m_entourageCards.clear();
+}
+
+void Cards::BuildIndexes()
+{
+    m_cardIndexes.reserve(m_cards.size());
+    m_cardsByID.reserve(m_cards.size());
+    m_cardsByDbfID.reserve(m_cards.size());
+    m_cardsByName.reserve(m_cards.size());
+
+    // NOTE: All lists of cards keep the order of m_cards. If there are cards
+    // that have the same key, the first card is kept as the linear search did.
+    for (Card* card : m_cards)
+    {
+        m_cardIndexes.try_emplace(card, m_cardIndexes.size());
+        m_cardsByID.try_emplace(card->id, card);
+        m_cardsByDbfID.try_emplace(card->dbfID, card);
+        m_cardsByName.try_emplace(card->name, card);
+
+        m_cardsByRarity[card->GetRarity()].emplace_back(card);
+        m_cardsByClass[card->GetCardClass()].emplace_back(card);
+        m_cardsBySet[card->GetCardSet()].emplace_back(card);
+        m_cardsByType[card->GetCardType()].emplace_back(card);
+        m_cardsByRace[card->GetRace()].emplace_back(card);
+
+        for (auto& gameTag : card->gameTags)
+        {
+            m_cardsByGameTag[gameTag.first].emplace_back(card);
+        }
+
+        m_cardsByCost[card->gameTags.at(GameTag::COST)].emplace_back(card);
+        m_cardsBySpellPower[card->gameTags.at(GameTag::SPELLPOWER)]
+            .emplace_back(card);
+
+        const CardType cardType = card->GetCardType();
+        if (cardType == CardType::MINION || cardType == CardType::WEAPON)
+        {
+            m_cardsByAttack[card->gameTags.at(GameTag::ATK)].emplace_back(
+                card);
+        }
+        if (cardType == CardType::MINION || cardType == CardType::HERO)
+        {
+            m_cardsByHealth[card->gameTags.at(GameTag::HEALTH)].emplace_back(
+                card);
+        }
+
+        if (card->gameTags.at(GameTag::COLLECTIBLE) == 1)
+        {
+            m_collectibleCards.emplace_back(card);
+        }
+
+        // A card belongs to all pools whose conditions are either the value
+        // of the card or INVALID.
+        for (const CardType type : { cardType, CardType::INVALID })
+        {
+            for (const CardClass cardClass :
+                 { card->GetCardClass(), CardClass::INVALID })
+            {
+                for (const Race race : { card->GetRace(), Race::INVALID })
+                {
+                    auto& pool = m_randomCardPools[{ type, cardClass, race }];
+                    if (pool.empty() || pool.back() != card)
+                    {
+                        pool.emplace_back(card);
+                    }
+                }
+            }
+        }
+    }
+
+    // NOTE: Entourages are resolved after indexing the IDs of all cards.
+    for (Card* card : m_cards)
+    {
+        if (card->entourages.empty())
+        {
+            continue;
+        }
+
+        auto& entourageCards = m_entourageCards[card->id];
+        for (const auto& entourage : card->entourages)
+        {
+            entourageCards.emplace_back(FindCardByID(entourage));
+        }
+    }
 }
 
 Cards& Cards::GetInstance()
@@ -43,126 +169,150 @@ const std::vector<Card*>& Cards::GetAllCards()
 
 Card* Cards::FindCardByID(const std::string& id)
 {
-    for (Card* card : m_cards)
+    const auto iter = m_cardsByID.find(id);
+    if (iter == m_cardsByID.end())
     {
-        if (card->id == id)
-        {
-            return card;
-        }
+        return &emptyCard;
     }
 
-    return &emptyCard;
+    return iter->second;
 }
 
 Card* Cards::FindCardByDbfID(int dbfID)
 {
-    for (Card* card : m_cards)
+    const auto iter = m_cardsByDbfID.find(dbfID);
+    if (iter == m_cardsByDbfID.end())
     {
-        if (card->dbfID == dbfID)
-        {
-            return card;
-        }
+        return &emptyCard;
     }
 
-    return &emptyCard;
+    return iter->second;
 }
 
-std::vector<Card*> Cards::FindCardByRarity(Rarity rarity)
+const std::vector<Card*>& Cards::FindCardByRarity(Rarity rarity)
 {
-    std::vector<Card*> result;
-
-    for (Card* card : m_cards)
-    {
-        if (card->GetRarity() == rarity)
-        {
-            result.emplace_back(card);
-        }
-    }
-
-    return result;
+    const auto iter = m_cardsByRarity.find(rarity);
+    return iter == m_cardsByRarity.end() ? emptyCards : iter->second;
 }
 
-std::vector<Card*> Cards::FindCardByClass(CardClass cardClass)
+const std::vector<Card*>& Cards::FindCardByClass(CardClass cardClass)
 {
-    std::vector<Card*> result;
+    const auto iter = m_cardsByClass.find(cardClass);
+    return iter == m_cardsByClass.end() ? emptyCards : iter->second;
+}
 
-    for (Card* card : m_cards)
-    {
-        if (card->GetCardClass() == cardClass)
-        {
-            result.emplace_back(card);
-        }
-    }
+const std::vector<Card*>& Cards::FindCardBySet(CardSet cardSet)
+{
+    const auto iter = m_cardsBySet.find(cardSet);
+    return iter == m_cardsBySet.end() ? emptyCards : iter->second;
+}
 
-    return result;
+const std::vector<Card*>& Cards::FindCardByType(CardType cardType)
+{
+    const auto iter = m_cardsByType.find(cardType);
+    return iter == m_cardsByType.end() ? emptyCards : iter->second;
 }
 
-std::vector<Card*> Cards::FindCardBySet(CardSet cardSet)
+const std::vector<Card*>& Cards::FindCardByRace(Race race)
 {
-    std::vector<Card*> result;
+    const auto iter = m_cardsByRace.find(race);
+    return iter == m_cardsByRace.end() ? emptyCards : iter->second;
+}
 
-    for (Card* card : m_cards)
+Card* Cards::FindCardByName(const std::string& name)
+{
+    const auto iter = m_cardsByName.find(name);
+    if (iter == m_cardsByName.end())
     {
-        if (card->GetCardSet() == cardSet)
-        {
-            result.emplace_back(card);
-        }
+        return &emptyCard;
     }
 
-    return result;
+    return iter->second;
 }
 
-std::vector<Card*> Cards::FindCardByType(CardType cardType)
+std::vector<Card*> Cards::FindCardByCost(int minVal, int maxVal)
 {
-    std::vector<Card*> result;
+    return FindCardByRange(m_cardsByCost, minVal, maxVal);
+}
 
-    for (Card* card : m_cards)
-    {
-        if (card->GetCardType() == cardType)
-        {
-            result.emplace_back(card);
-        }
-    }
+std::vector<Card*> Cards::FindCardByAttack(int minVal, int maxVal)
+{
+    return FindCardByRange(m_cardsByAttack, minVal, maxVal);
+}
 
-    return result;
+std::vector<Card*> Cards::FindCardByHealth(int minVal, int maxVal)
+{
+    return FindCardByRange(m_cardsByHealth, minVal, maxVal);
 }
 
-std::vector<Card*> Cards::FindCardByRace(Race race)
+std::vector<Card*> Cards::FindCardBySpellPower(int minVal, int maxVal)
+{
+    return FindCardByRange(m_cardsBySpellPower, minVal, maxVal);
+}
+
+std::vector<Card*> Cards::FindCardByGameTag(std::vector<GameTag> gameTags)
 {
     std::vector<Card*> result;
 
-    for (Card* card : m_cards)
+    for (auto& card : m_cards)
     {
-        if (card->GetRace() == race)
+        for (const auto gameTag : gameTags)
         {
-            result.emplace_back(card);
+            if (card->HasGameTag(gameTag))
+            {
+                result.emplace_back(card);
+            }
         }
     }
 
     return result;
 }
 
-Card* Cards::FindCardByName(const std::string& name)
+std::vector<Card*> Cards::FindCards(const SearchFilter& filter)
 {
-    for (Card* card : m_cards)
-    {
-        if (card->name == name)
+    const std::vector<Card*>* candidates = &m_cards;
+    const auto narrowDown = [&candidates](const std::vector<Card*>& cards) {
+        if (cards.size() < candidates->size())
         {
-            return card;
+            candidates = &cards;
         }
-    }
+    };
 
-    return &emptyCard;
-}
+    if (filter.onlyCollectible)
+    {
+        narrowDown(m_collectibleCards);
+    }
+    if (filter.rarity != Rarity::INVALID)
+    {
+        narrowDown(FindCardByRarity(filter.rarity));
+    }
+    if (filter.playerClass != CardClass::INVALID && !filter.includeNeutral)
+    {
+        narrowDown(FindCardByClass(filter.playerClass));
+    }
+    if (filter.cardSet != CardSet::ALL)
+    {
+        narrowDown(FindCardBySet(filter.cardSet));
+    }
+    if (filter.cardType != CardType::INVALID)
+    {
+        narrowDown(FindCardByType(filter.cardType));
+    }
+    if (filter.race != Race::INVALID)
+    {
+        narrowDown(FindCardByRace(filter.race));
+    }
+    if (filter.gameTag != GameTag::INVALID)
+    {
+        const auto iter = m_cardsByGameTag.find(filter.gameTag);
+        narrowDown(iter == m_cardsByGameTag.end() ? emptyCards : iter->second);
+    }
 
-std::vector<Card*> Cards::FindCardByCost(int minVal, int maxVal)
-{
     std::vector<Card*> result;
 
-    for (Card* card : m_cards)
+    for (Card* card : *candidates)
     {
-        if (card->gameTags.at(GameTag::COST) >= minVal &&
-            card->gameTags.at(GameTag::COST) <= maxVal)
+        if (IsMatched(card, filter))
         {
             result.emplace_back(card);
         }
@@ -171,84 +321,105 @@ std::vector<Card*> Cards::FindCardByCost(int minVal, int maxVal)
     return result;
 }
 
-std::vector<Card*> Cards::FindCardByAttack(int minVal, int maxVal)
+std::vector<Card*> Cards::FindCardByRange(
+    const std::map<int, std::vector<Card*>>& index, int minVal, int maxVal)
 {
     std::vector<Card*> result;
 
-    for (Card* card : m_cards)
+    if (minVal > maxVal)
     {
-        if (!(card->GetCardType() == CardType::MINION) &&
-            !(card->GetCardType() == CardType::WEAPON))
-        {
-            continue;
-        }
+        return result;
+    }
 
-        if (card->gameTags.at(GameTag::ATK) >= minVal &&
-            card->gameTags.at(GameTag::ATK) <= maxVal)
-        {
-            result.emplace_back(card);
-        }
+    const auto begin = index.lower_bound(minVal);
+    const auto end = index.upper_bound(maxVal);
+    for (auto iter = begin; iter != end; ++iter)
+    {
+        result.insert(result.end(), iter->second.begin(), iter->second.end());
+    }
+
+    // NOTE: Each list of the index is in the order of m_cards, but the lists
+    // of several values must be merged into that order.
+    if (begin != end && std::next(begin) != end)
+    {
+        std::sort(result.begin(), result.end(),
+                  [](const Card* lhs, const Card* rhs) {
+                      return m_cardIndexes.at(lhs) < m_cardIndexes.at(rhs);
+                  });
     }
 
     return result;
 }
 
-std::vector<Card*> Cards::FindCardByHealth(int minVal, int maxVal)
+bool Cards::IsMatched(const Card* card, const SearchFilter& filter)
 {
-    std::vector<Card*> result;
-
-    for (Card* card : m_cards)
+    if (filter.onlyCollectible &&
+        card->gameTags.at(GameTag::COLLECTIBLE) == 0)
     {
-        if (!(card->GetCardType() == CardType::MINION) &&
-            !(card->GetCardType() == CardType::HERO))
-        {
-            continue;
-        }
-
-        if (card->gameTags.at(GameTag::HEALTH) >= minVal &&
-            card->gameTags.at(GameTag::HEALTH) <= maxVal)
-        {
-            result.emplace_back(card);
-        }
+        return false;
     }
 
-    return result;
-}
+    if (filter.rarity != Rarity::INVALID && filter.rarity != card->GetRarity())
+    {
+        return false;
+    }
 
-std::vector<Card*> Cards::FindCardBySpellPower(int minVal, int maxVal)
-{
-    std::vector<Card*> result;
+    if (filter.playerClass != CardClass::INVALID &&
+        filter.playerClass != card->GetCardClass() &&
+        !(filter.includeNeutral &&
+          card->GetCardClass() == CardClass::NEUTRAL))
+    {
+        return false;
+    }
 
-    for (Card* card : m_cards)
+    if (filter.cardSet != CardSet::ALL && filter.cardSet != card->GetCardSet())
     {
-        if (card->gameTags.at(GameTag::SPELLPOWER) >= minVal &&
-            card->gameTags.at(GameTag::SPELLPOWER) <= maxVal)
-        {
-            result.emplace_back(card);
-        }
+        return false;
     }
 
-    return result;
-}
+    if (filter.cardType != CardType::INVALID &&
+        filter.cardType != card->GetCardType())
+    {
+        return false;
+    }
 
-std::vector<Card*> Cards::FindCardByGameTag(std::vector<GameTag> gameTags)
-{
-    std::vector<Card*> result;
+    if (filter.race != Race::INVALID && filter.race != card->GetRace())
+    {
+        return false;
+    }
 
-    for (auto& card : m_cards)
+    if (filter.gameTag != GameTag::INVALID && !card->HasGameTag(filter.gameTag))
     {
-        auto cardGameTags = card->gameTags;
+        return false;
+    }
 
-        for (const auto gameTag : gameTags)
-        {
-            if (cardGameTags.find(gameTag) != cardGameTags.end())
-            {
-                result.emplace_back(card);
-            }
-        }
+    if (!filter.name.empty() &&
+        card->name.find(filter.name) == std::string::npos)
+    {
+        return false;
     }
 
-    return result;
+    const int cost = card->gameTags.at(GameTag::COST);
+    const int attack = card->gameTags.at(GameTag::ATK);
+    const int health = card->gameTags.at(GameTag::HEALTH);
+
+    return filter.costMin <= cost && filter.costMax >= cost &&
+           filter.attackMin <= attack && filter.attackMax >= attack &&
+           filter.healthMin <= health && filter.healthMax >= health;
+}
+
+const std::vector<Card*>& Cards::GetRandomCardPool(CardType cardType,
+                                                  CardClass cardClass,
+                                                  Race race)
+{
+    const auto iter = m_randomCardPools.find({ cardType, cardClass, race });
+    return iter == m_randomCardPools.end() ? emptyCards : iter->second;
+}
+
+const std::vector<Card*>& Cards::GetEntourageCards(const Card* card)
+{
+    const auto iter = m_entourageCards.find(card->id);
+    return iter == m_entourageCards.end() ? emptyCards : iter->second;
 }
 
 Card* Cards::GetHeroCard(CardClass cardClass)
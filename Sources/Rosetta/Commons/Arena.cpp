@@ -0,0 +1,179 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Commons/Arena.hpp>
+
+#include <new>
+
+namespace RosettaStone
+{
+Arena::~Arena()
+{
+    Release();
+}
+
+void* Arena::Allocate(std::size_t size)
+{
+    if (size == 0)
+    {
+        size = 1;
+    }
+
+    if (size > MAX_ALLOC_SIZE)
+    {
+        static_assert(sizeof(LargeBlock) <= LARGE_BLOCK_HEADER_SIZE,
+                      "The header must fit in the reserved space.");
+
+        auto block = static_cast<LargeBlock*>(
+            ::operator new(size + LARGE_BLOCK_HEADER_SIZE));
+        block->prev = nullptr;
+        block->next = m_largeBlocks;
+        if (m_largeBlocks != nullptr)
+        {
+            m_largeBlocks->prev = block;
+        }
+        m_largeBlocks = block;
+        ++m_numLargeBlocks;
+
+        return reinterpret_cast<char*>(block) + LARGE_BLOCK_HEADER_SIZE;
+    }
+
+    const std::size_t sizeClass = (size - 1) / ALIGNMENT;
+    FreeNode* node = m_freeLists[sizeClass];
+    if (node != nullptr)
+    {
+        m_freeLists[sizeClass] = node->next;
+        return node;
+    }
+
+    const std::size_t allocSize = (sizeClass + 1) * ALIGNMENT;
+    if (static_cast<std::size_t>(m_end - m_cur) < allocSize)
+    {
+        // The rest of the current block is abandoned until the arena is
+        // released. It is smaller than the maximum allocation size.
+        m_cur = static_cast<char*>(::operator new(BLOCK_SIZE));
+        m_end = m_cur + BLOCK_SIZE;
+        m_blocks.emplace_back(m_cur);
+    }
+
+    void* ptr = m_cur;
+    m_cur += allocSize;
+
+    return ptr;
+}
+
+void Arena::Deallocate(void* ptr, std::size_t size)
+{
+    if (size == 0)
+    {
+        size = 1;
+    }
+
+    if (size > MAX_ALLOC_SIZE)
+    {
+        auto block = reinterpret_cast<LargeBlock*>(static_cast<char*>(ptr) -
+                                                   LARGE_BLOCK_HEADER_SIZE);
+        if (block->prev != nullptr)
+        {
+            block->prev->next = block->next;
+        }
+        else
+        {
+            m_largeBlocks = block->next;
+        }
+        if (block->next != nullptr)
+        {
+            block->next->prev = block->prev;
+        }
+        --m_numLargeBlocks;
+
+        ::operator delete(block);
+        return;
+    }
+
+    const std::size_t sizeClass = (size - 1) / ALIGNMENT;
+    auto node = static_cast<FreeNode*>(ptr);
+    node->next = m_freeLists[sizeClass];
+    m_freeLists[sizeClass] = node;
+}
+
+void Arena::Release()
+{
+    for (auto& block : m_blocks)
+    {
+        ::operator delete(block);
+    }
+
+    while (m_largeBlocks != nullptr)
+    {
+        LargeBlock* next = m_largeBlocks->next;
+        ::operator delete(m_largeBlocks);
+        m_largeBlocks = next;
+    }
+
+    m_blocks.clear();
+    m_numLargeBlocks = 0;
+    m_freeLists.fill(nullptr);
+    m_cur = nullptr;
+    m_end = nullptr;
+}
+
+std::size_t Arena::GetNumBlocks() const
+{
+    return m_blocks.size();
+}
+
+std::size_t Arena::GetNumLargeBlocks() const
+{
+    return m_numLargeBlocks;
+}
+
+void* ArenaObject::operator new(std::size_t size)
+{
+    return operator new(size, nullptr);
+}
+
+void* ArenaObject::operator new(std::size_t size, Arena* arena)
+{
+    static_assert(sizeof(Header) <= HEADER_SIZE,
+                  "The header must fit in the reserved space.");
+
+    const std::size_t allocSize = size + HEADER_SIZE;
+    void* ptr = arena != nullptr ? arena->Allocate(allocSize)
+                                 : ::operator new(allocSize);
+
+    auto header = static_cast<Header*>(ptr);
+    header->arena = arena;
+    header->size = allocSize;
+
+    return static_cast<char*>(ptr) + HEADER_SIZE;
+}
+
+void ArenaObject::operator delete(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    void* base = static_cast<char*>(ptr) - HEADER_SIZE;
+    const auto header = static_cast<Header*>(base);
+
+    if (header->arena != nullptr)
+    {
+        header->arena->Deallocate(base, header->size);
+    }
+    else
+    {
+        ::operator delete(base);
+    }
+}
+
+void ArenaObject::operator delete(void* ptr, [[maybe_unused]] Arena* arena)
+{
+    operator delete(ptr);
+}
+}  // namespace RosettaStone
@@ -0,0 +1,309 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Commons/GameTagStorage.hpp>
+#include <Rosetta/Commons/Utils.hpp>
+
+#include <algorithm>
+
+namespace RosettaStone
+{
+//! The number of game tags.
+constexpr std::size_t NUM_GAME_TAGS = 0
+#define X(a) +1
+#include <Rosetta/Enums/GameTag.def>
+#undef X
+    ;
+
+//! The game tags that are stored in the dense array. They are selected by
+//! the number of references in the simulator and the number of mechanics in
+//! the card data.
+constexpr GameTag HOT_GAME_TAGS[] = {
+    GameTag::ZONE,
+    GameTag::ZONE_POSITION,
+    GameTag::ENTITY_ID,
+    GameTag::CONTROLLER,
+    GameTag::CARDTYPE,
+    GameTag::CARDRACE,
+    GameTag::CARD_SET,
+    GameTag::CLASS,
+    GameTag::COLLECTIBLE,
+    GameTag::FACTION,
+    GameTag::RARITY,
+    GameTag::COST,
+    GameTag::ATK,
+    GameTag::HEALTH,
+    GameTag::DAMAGE,
+    GameTag::PREDAMAGE,
+    GameTag::ARMOR,
+    GameTag::DURABILITY,
+    GameTag::SPELLPOWER,
+    GameTag::EXHAUSTED,
+    GameTag::NUM_ATTACKS_THIS_TURN,
+    GameTag::CHARGE,
+    GameTag::RUSH,
+    GameTag::WINDFURY,
+    GameTag::TAUNT,
+    GameTag::FROZEN,
+    GameTag::FREEZE,
+    GameTag::DIVINE_SHIELD,
+    GameTag::STEALTH,
+    GameTag::IMMUNE,
+    GameTag::POISONOUS,
+    GameTag::LIFESTEAL,
+    GameTag::SILENCED,
+    GameTag::ENRAGED,
+    GameTag::CANT_ATTACK,
+    GameTag::CANNOT_ATTACK_HEROES,
+    GameTag::CANT_PLAY,
+    GameTag::CANT_BE_TARGETED_BY_SPELLS,
+    GameTag::CANT_BE_TARGETED_BY_HERO_POWERS,
+    GameTag::BATTLECRY,
+    GameTag::DEATHRATTLE,
+    GameTag::INSPIRE,
+    GameTag::COMBO,
+    GameTag::CHOOSE_ONE,
+    GameTag::DISCOVER,
+    GameTag::SECRET,
+    GameTag::AURA,
+    GameTag::TRIGGER_VISUAL,
+    GameTag::OVERLOAD,
+    GameTag::OVERLOAD_OWED,
+    GameTag::OVERLOAD_LOCKED,
+    GameTag::RESOURCES,
+    GameTag::RESOURCES_USED,
+    GameTag::TEMP_RESOURCES,
+    GameTag::COMBO_ACTIVE,
+    GameTag::NUM_MINIONS_PLAYED_THIS_TURN,
+    GameTag::TAG_SCRIPT_DATA_NUM_1,
+    GameTag::TAG_SCRIPT_DATA_NUM_2,
+    GameTag::TAG_LAST_KNOWN_COST_IN_HAND,
+    GameTag::REVEALED,
+    GameTag::DISPLAYED_CREATOR,
+    GameTag::TAG_ONE_TURN_EFFECT,
+};
+
+static_assert(sizeof(HOT_GAME_TAGS) / sizeof(HOT_GAME_TAGS[0]) ==
+                  NUM_HOT_GAME_TAGS,
+              "The number of hot game tags is mismatched.");
+static_assert(NUM_HOT_GAME_TAGS <= 64,
+              "The hot game tags must fit in 64-bit flags.");
+
+//! Makes the table that maps game tag to the index of the dense array.
+//! \return The table that maps game tag to the index, or -1 if it is rare.
+constexpr std::array<int, NUM_GAME_TAGS> MakeHotGameTagTable()
+{
+    std::array<int, NUM_GAME_TAGS> table{};
+
+    for (std::size_t i = 0; i < NUM_GAME_TAGS; ++i)
+    {
+        table[i] = -1;
+    }
+
+    for (std::size_t i = 0; i < NUM_HOT_GAME_TAGS; ++i)
+    {
+        table[static_cast<std::size_t>(HOT_GAME_TAGS[i])] =
+            static_cast<int>(i);
+    }
+
+    return table;
+}
+
+constexpr std::array<int, NUM_GAME_TAGS> HOT_GAME_TAG_INDEX =
+    MakeHotGameTagTable();
+
+//! The game tags that the reduced board view can see, either as they are or
+//! through the mana and the attackable flags. The other game tags such as
+//! ENTITY_ID are not added to the hash, so they don't separate boards that
+//! are reached by different orders of actions.
+constexpr GameTag VIEW_GAME_TAGS[] = {
+    GameTag::ZONE_POSITION,
+    GameTag::COST,
+    GameTag::ATK,
+    GameTag::HEALTH,
+    GameTag::DAMAGE,
+    GameTag::ARMOR,
+    GameTag::DURABILITY,
+    GameTag::EXHAUSTED,
+    GameTag::NUM_ATTACKS_THIS_TURN,
+    GameTag::CHARGE,
+    GameTag::WINDFURY,
+    GameTag::TAUNT,
+    GameTag::FROZEN,
+    GameTag::STEALTH,
+    GameTag::IMMUNE,
+    GameTag::SILENCED,
+    GameTag::CANT_ATTACK,
+    GameTag::CANNOT_ATTACK_HEROES,
+    GameTag::OVERLOAD_OWED,
+    GameTag::OVERLOAD_LOCKED,
+    GameTag::RESOURCES,
+    GameTag::RESOURCES_USED,
+    GameTag::TEMP_RESOURCES,
+};
+
+//! Makes the table that marks the game tags that the view can see.
+//! \return The table that marks the game tags that the view can see.
+constexpr std::array<bool, NUM_GAME_TAGS> MakeViewGameTagTable()
+{
+    std::array<bool, NUM_GAME_TAGS> table{};
+
+    for (const GameTag tag : VIEW_GAME_TAGS)
+    {
+        table[static_cast<std::size_t>(tag)] = true;
+    }
+
+    return table;
+}
+
+constexpr std::array<bool, NUM_GAME_TAGS> IS_VIEW_GAME_TAG =
+    MakeViewGameTagTable();
+
+//! Returns the hash of a pair of game tag and its value. It is zero if the
+//! game tag is not seen by the view.
+//! \param tag The game tag.
+//! \param value The value of game tag.
+//! \return The hash of the pair.
+constexpr std::uint64_t HashGameTag(GameTag tag, int value)
+{
+    if (!IS_VIEW_GAME_TAG[static_cast<std::size_t>(tag)])
+    {
+        return 0;
+    }
+
+    return MixHash((static_cast<std::uint64_t>(tag) << 32) ^
+                   static_cast<std::uint32_t>(value));
+}
+
+GameTagStorage::GameTagStorage(std::map<GameTag, int> tags)
+{
+    for (auto& [tag, value] : tags)
+    {
+        Set(tag, value);
+    }
+}
+
+bool GameTagStorage::Contains(GameTag tag) const
+{
+    return Find(tag) != nullptr;
+}
+
+const int* GameTagStorage::Find(GameTag tag) const
+{
+    const int index = HOT_GAME_TAG_INDEX[static_cast<std::size_t>(tag)];
+    if (index >= 0)
+    {
+        return (m_flags >> index) & 1 ? &m_values[index] : nullptr;
+    }
+
+    const auto iter = std::lower_bound(
+        m_extraTags.begin(), m_extraTags.end(), tag,
+        [](const std::pair<GameTag, int>& left, GameTag right) {
+            return left.first < right;
+        });
+    if (iter == m_extraTags.end() || iter->first != tag)
+    {
+        return nullptr;
+    }
+
+    return &iter->second;
+}
+
+int GameTagStorage::Get(GameTag tag) const
+{
+    const int* value = Find(tag);
+    return value == nullptr ? 0 : *value;
+}
+
+void GameTagStorage::Set(GameTag tag, int value)
+{
+    const int index = HOT_GAME_TAG_INDEX[static_cast<std::size_t>(tag)];
+    if (index >= 0)
+    {
+        if ((m_flags >> index) & 1)
+        {
+            m_hash -= HashGameTag(tag, m_values[index]);
+        }
+
+        m_flags |= std::uint64_t{ 1 } << index;
+        m_values[index] = value;
+        m_hash += HashGameTag(tag, value);
+        return;
+    }
+
+    const auto iter = std::lower_bound(
+        m_extraTags.begin(), m_extraTags.end(), tag,
+        [](const std::pair<GameTag, int>& left, GameTag right) {
+            return left.first < right;
+        });
+    if (iter == m_extraTags.end() || iter->first != tag)
+    {
+        m_extraTags.emplace(iter, tag, value);
+    }
+    else
+    {
+        m_hash -= HashGameTag(tag, iter->second);
+        iter->second = value;
+    }
+
+    m_hash += HashGameTag(tag, value);
+}
+
+void GameTagStorage::Erase(GameTag tag)
+{
+    const int index = HOT_GAME_TAG_INDEX[static_cast<std::size_t>(tag)];
+    if (index >= 0)
+    {
+        if ((m_flags >> index) & 1)
+        {
+            m_hash -= HashGameTag(tag, m_values[index]);
+        }
+
+        m_flags &= ~(std::uint64_t{ 1 } << index);
+        m_values[index] = 0;
+        return;
+    }
+
+    const auto iter = std::lower_bound(
+        m_extraTags.begin(), m_extraTags.end(), tag,
+        [](const std::pair<GameTag, int>& left, GameTag right) {
+            return left.first < right;
+        });
+    if (iter != m_extraTags.end() && iter->first == tag)
+    {
+        m_hash -= HashGameTag(tag, iter->second);
+        m_extraTags.erase(iter);
+    }
+}
+
+void GameTagStorage::Clear()
+{
+    m_flags = 0;
+    m_values.fill(0);
+    m_extraTags.clear();
+    m_hash = 0;
+}
+
+std::map<GameTag, int> GameTagStorage::ToMap() const
+{
+    std::map<GameTag, int> tags(m_extraTags.begin(), m_extraTags.end());
+
+    for (std::size_t i = 0; i < NUM_HOT_GAME_TAGS; ++i)
+    {
+        if ((m_flags >> i) & 1)
+        {
+            tags.emplace(HOT_GAME_TAGS[i], m_values[i]);
+        }
+    }
+
+    return tags;
+}
+
+std::uint64_t GameTagStorage::GetHash() const
+{
+    return m_hash;
+}
+}  // namespace RosettaStone
@@ -0,0 +1,79 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Commons/Random.hpp>
+
+#include <random>
+
+namespace RosettaStone
+{
+Random::Random()
+{
+    std::random_device device;
+    const std::uint64_t high = device();
+    const std::uint64_t low = device();
+
+    Seed((high << 32) ^ low);
+}
+
+Random::Random(std::uint64_t seed)
+{
+    Seed(seed);
+}
+
+void Random::Seed(std::uint64_t seed)
+{
+    // Expand the seed to the state by using splitmix64
+    for (auto& state : m_state)
+    {
+        seed += 0x9e3779b97f4a7c15;
+
+        std::uint64_t z = seed;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        state = z ^ (z >> 31);
+    }
+}
+
+Random::result_type Random::operator()()
+{
+    const auto rotl = [](std::uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    };
+
+    const std::uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+    const std::uint64_t t = m_state[1] << 17;
+
+    m_state[2] ^= m_state[0];
+    m_state[3] ^= m_state[1];
+    m_state[1] ^= m_state[2];
+    m_state[0] ^= m_state[3];
+    m_state[2] ^= t;
+    m_state[3] = rotl(m_state[3], 45);
+
+    return result;
+}
+
+std::uint64_t Random::GetBounded(std::uint64_t range)
+{
+    if (range == max())
+    {
+        return (*this)();
+    }
+
+    // Reject the values in the last incomplete bucket to avoid modulo bias
+    const std::uint64_t bound = range + 1;
+    const std::uint64_t limit = max() - max() % bound;
+
+    std::uint64_t value;
+    do
+    {
+        value = (*this)();
+    } while (value >= limit);
+
+    return value % bound;
+}
+}  // namespace RosettaStone
@@ -86,7 +86,7 @@ SelfCondition SelfCondition::IsRace(Race race)
 SelfCondition SelfCondition::IsControllingRace(Race race)
 {
     return SelfCondition([=](Entity* entity) -> bool {
-        for (auto& minion : entity->owner->GetFieldZone().GetAll())
+        for (auto& minion : entity->owner->GetFieldZone().GetAlive())
         {
             if (minion->card->GetRace() == race)
             {
@@ -136,7 +136,7 @@ SelfCondition SelfCondition::IsFrozen()
 SelfCondition SelfCondition::HasMinionInHand()
 {
     return SelfCondition([=](Entity* entity) -> bool {
-        for (auto& card : entity->owner->GetHandZone().GetAll())
+        for (auto& card : entity->owner->GetHandZone().GetAlive())
         {
             if (dynamic_cast<Minion*>(card) != nullptr)
             {
@@ -42,7 +42,7 @@ void Aura::Activate(Entity* owner, bool cloning)
         m_effects = card->power.GetEnchant()->effects;
     }
 
-    auto instance = new Aura(*this, *owner);
+    auto instance = new (owner->owner->GetArena()) Aura(*this, *owner);
 
     owner->owner->GetGame()->auras.emplace_back(instance);
     owner->onGoingEffect = instance;
@@ -61,7 +61,7 @@ void Aura::Activate(Entity* owner, bool cloning)
     {
         case AuraType::FIELD:
         {
-            for (auto& minion : owner->owner->GetFieldZone().GetAll())
+            for (auto& minion : owner->owner->GetFieldZone().GetAlive())
             {
                 if (condition == nullptr || condition->Evaluate(minion))
                 {
@@ -79,7 +79,7 @@ void Aura::Activate(Entity* owner, bool cloning)
         }
         case AuraType::FIELD_EXCEPT_SOURCE:
         {
-            for (auto& minion : owner->owner->GetFieldZone().GetAll())
+            for (auto& minion : owner->owner->GetFieldZone().GetAlive())
             {
                 if (minion == owner)
                 {
@@ -149,6 +149,25 @@ void Aura::Clone(Entity* clone)
     dynamic_cast<Aura*>(clone->onGoingEffect)->SetToBeUpdated(m_toBeUpdated);
 }
 
+IAura* Aura::Copy(const std::map<const Entity*, Entity*>& entities)
+{
+    Entity* owner = entities.at(m_owner);
+    auto instance = new (owner->owner->GetArena()) Aura(*this, *owner);
+
+    for (auto& entity : m_appliedEntities)
+    {
+        instance->m_appliedEntities.emplace_back(entities.at(entity));
+    }
+    for (auto& entity : m_tempList)
+    {
+        instance->m_tempList.emplace_back(entities.at(entity));
+    }
+
+    instance->m_toBeUpdated = m_toBeUpdated;
+
+    return instance;
+}
+
 void Aura::Apply(Entity* entity)
 {
     const auto iter =
@@ -270,14 +289,14 @@ void Aura::UpdateInternal()
                 break;
             }
             case AuraType::FIELD:
-                for (auto& minion : m_owner->owner->GetFieldZone().GetAll())
+                for (auto& minion : m_owner->owner->GetFieldZone().GetAlive())
                 {
                     Apply(minion);
                 }
                 break;
             case AuraType::FIELD_EXCEPT_SOURCE:
             {
-                for (auto& minion : m_owner->owner->GetFieldZone().GetAll())
+                for (auto& minion : m_owner->owner->GetFieldZone().GetAlive())
                 {
                     if (minion != m_owner)
                     {
@@ -288,7 +307,7 @@ void Aura::UpdateInternal()
             }
             case AuraType::HAND:
             {
-                for (auto& card : m_owner->owner->GetHandZone().GetAll())
+                for (auto& card : m_owner->owner->GetHandZone().GetAlive())
                 {
                     Apply(card);
                 }
@@ -373,7 +392,8 @@ AdaptiveEffect::AdaptiveEffect(SelfCondition* _condition,
 
 void AdaptiveEffect::Activate(Entity* owner, bool)
 {
-    auto instance = new AdaptiveEffect(*this, *owner);
+    auto instance =
+        new (owner->owner->GetArena()) AdaptiveEffect(*this, *owner);
 
     owner->owner->GetGame()->auras.emplace_back(instance);
     owner->onGoingEffect = instance;
@@ -410,6 +430,12 @@ void AdaptiveEffect::Clone(Entity* clone)
     Activate(clone);
 }
 
+IAura* AdaptiveEffect::Copy(const std::map<const Entity*, Entity*>& entities)
+{
+    Entity* owner = entities.at(m_owner);
+    return new (owner->owner->GetArena()) AdaptiveEffect(*this, *owner);
+}
+
 AdaptiveEffect::AdaptiveEffect(AdaptiveEffect& prototype, Entity& owner)
     : Aura(prototype, owner)
 {
@@ -439,7 +465,8 @@ void EnrageEffect::Activate(Entity* owner, bool)
         owner = enchantment->GetTarget();
     }
 
-    auto instance = new EnrageEffect(*this, *owner);
+    auto instance =
+        new (owner->owner->GetArena()) EnrageEffect(*this, *owner);
     owner->owner->GetGame()->auras.emplace_back(instance);
     owner->onGoingEffect = instance;
 }
@@ -513,6 +540,12 @@ void EnrageEffect::Clone(Entity* clone)
     Activate(clone, true);
 }
 
+IAura* EnrageEffect::Copy(const std::map<const Entity*, Entity*>& entities)
+{
+    Entity* owner = entities.at(m_owner);
+    return new (owner->owner->GetArena()) EnrageEffect(*this, *owner);
+}
+
 EnrageEffect::EnrageEffect(EnrageEffect& prototype, Entity& owner)
     : Aura(prototype, owner)
 {
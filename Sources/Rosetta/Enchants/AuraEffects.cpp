@@ -12,6 +12,12 @@ AuraEffects::AuraEffects(Entity* owner) : m_owner(owner)
     // Do nothing
 }
 
+AuraEffects::AuraEffects(const AuraEffects& prototype, Entity* owner)
+    : m_owner(owner), m_gameTags(prototype.m_gameTags)
+{
+    // Do nothing
+}
+
 Entity* AuraEffects::GetOwner() const
 {
     return m_owner;
@@ -19,16 +25,11 @@ Entity* AuraEffects::GetOwner() const
 
 int AuraEffects::GetGameTag(GameTag tag) const
 {
-    if (m_gameTags.find(tag) == m_gameTags.end())
-    {
-        return 0;
-    }
-
-    return m_gameTags.at(tag);
+    return m_gameTags.Get(tag);
 }
 
 void AuraEffects::SetGameTag(GameTag tag, int value)
 {
-    m_gameTags.insert_or_assign(tag, value);
+    m_gameTags.Set(tag, value);
 }
 }  // namespace RosettaStone
@@ -9,10 +9,6 @@
 #include <Rosetta/Models/Enchantment.hpp>
 #include <Rosetta/Tasks/ITask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone
 {
 Trigger::Trigger(TriggerType type) : m_triggerType(type)
@@ -44,6 +40,7 @@ Trigger::Trigger(Trigger& prototype, Entity& owner)
     : triggerSource(prototype.triggerSource),
       tasks(prototype.tasks),
       condition(prototype.condition),
+      percentage(prototype.percentage),
       fastExecution(prototype.fastExecution),
       removeAfterTriggered(prototype.removeAfterTriggered),
       m_owner(&owner),
@@ -65,18 +62,11 @@ void Trigger::Activate(Entity* source, TriggerActivation activation,
         }
     }
 
-    auto* instance = new Trigger(*this, *source);
+    auto* instance = new (source->owner->GetArena()) Trigger(*this, *source);
     Game* game = source->owner->GetGame();
 
     source->activatedTrigger = instance;
 
-    auto triggerFunc = [this, instance](Player* p, Entity* e) { 
-        if (percentage == 1.0f || Random::get<float>(0.0f, 1.0f) < percentage)
-        {
-            instance->Process(p, e);
-        }
-    };
-
     if (m_sequenceType != SequenceType::NONE)
     {
         source->owner->GetGame()->triggers.emplace_back(instance);
@@ -84,32 +74,12 @@ void Trigger::Activate(Entity* source, TriggerActivation activation,
 
     switch (m_triggerType)
     {
-        case TriggerType::TURN_START:
-            game->triggerManager.startTurnTrigger = std::move(triggerFunc);
-            break;
-        case TriggerType::TURN_END:
-            game->triggerManager.endTurnTrigger = std::move(triggerFunc);
-            break;
-        case TriggerType::PLAY_CARD:
-            game->triggerManager.playCardTrigger = std::move(triggerFunc);
-            break;
-        case TriggerType::AFTER_PLAY_MINION:
-            game->triggerManager.afterPlayMinionTrigger =
-                std::move(triggerFunc);
-            break;
-        case TriggerType::CAST_SPELL:
-            game->triggerManager.castSpellTrigger = std::move(triggerFunc);
-            break;
-        case TriggerType::AFTER_CAST:
-            game->triggerManager.afterCastTrigger = std::move(triggerFunc);
-            break;
-        case TriggerType::HEAL:
-            game->triggerManager.healTrigger = std::move(triggerFunc);
-            break;
-        case TriggerType::ATTACK:
-            game->triggerManager.attackTrigger = std::move(triggerFunc);
-            break;
         case TriggerType::AFTER_ATTACK:
+        {
+            auto triggerFunc = [instance](Player* p, Entity* e) {
+                instance->Invoke(p, e);
+            };
+
             switch (triggerSource)
             {
                 case TriggerSource::HERO:
@@ -136,19 +106,13 @@ void Trigger::Activate(Entity* source, TriggerActivation activation,
                     break;
             }
             break;
-        case TriggerType::SUMMON:
-            game->triggerManager.summonTrigger = std::move(triggerFunc);
-            break;
-        case TriggerType::AFTER_SUMMON:
-            game->triggerManager.afterSummonTrigger = std::move(triggerFunc);
-            break;
-        case TriggerType::DEAL_DAMAGE:
-            game->triggerManager.dealDamageTrigger = std::move(triggerFunc);
-            break;
-        case TriggerType::TAKE_DAMAGE:
-            game->triggerManager.takeDamageTrigger = std::move(triggerFunc);
-            break;
+        }
         case TriggerType::PREDAMAGE:
+        {
+            auto triggerFunc = [instance](Player* p, Entity* e) {
+                instance->Invoke(p, e);
+            };
+
             switch (triggerSource)
             {
                 case TriggerSource::HERO:
@@ -175,44 +139,25 @@ void Trigger::Activate(Entity* source, TriggerActivation activation,
                     break;
             }
             break;
-        case TriggerType::TARGET:
-            game->triggerManager.targetTrigger = std::move(triggerFunc);
-            break;
+        }
         default:
+        {
+            TriggerEvent* event = game->triggerManager.GetEvent(m_triggerType);
+            if (event != nullptr)
+            {
+                event->Subscribe(instance);
+            }
             break;
+        }
     }
 }
 
-void Trigger::Remove() const
+void Trigger::Remove()
 {
     Game* game = m_owner->owner->GetGame();
 
     switch (m_triggerType)
     {
-        case TriggerType::TURN_START:
-            game->triggerManager.startTurnTrigger = nullptr;
-            break;
-        case TriggerType::TURN_END:
-            game->triggerManager.endTurnTrigger = nullptr;
-            break;
-        case TriggerType::PLAY_CARD:
-            game->triggerManager.playCardTrigger = nullptr;
-            break;
-        case TriggerType::AFTER_PLAY_MINION:
-            game->triggerManager.afterPlayMinionTrigger = nullptr;
-            break;
-        case TriggerType::CAST_SPELL:
-            game->triggerManager.castSpellTrigger = nullptr;
-            break;
-        case TriggerType::AFTER_CAST:
-            game->triggerManager.afterCastTrigger = nullptr;
-            break;
-        case TriggerType::HEAL:
-            game->triggerManager.healTrigger = nullptr;
-            break;
-        case TriggerType::ATTACK:
-            game->triggerManager.attackTrigger = nullptr;
-            break;
         case TriggerType::AFTER_ATTACK:
             switch (triggerSource)
             {
@@ -239,17 +184,6 @@ void Trigger::Remove() const
                 default:
                     break;
             }
-        case TriggerType::SUMMON:
-            game->triggerManager.summonTrigger = nullptr;
-            break;
-        case TriggerType::AFTER_SUMMON:
-            game->triggerManager.afterSummonTrigger = nullptr;
-            break;
-        case TriggerType::DEAL_DAMAGE:
-            game->triggerManager.dealDamageTrigger = nullptr;
-            break;
-        case TriggerType::TAKE_DAMAGE:
-            game->triggerManager.takeDamageTrigger = nullptr;
             break;
         case TriggerType::PREDAMAGE:
             switch (triggerSource)
@@ -277,11 +211,16 @@ void Trigger::Remove() const
                 default:
                     break;
             }
-        case TriggerType::TARGET:
-            game->triggerManager.targetTrigger = nullptr;
             break;
         default:
+        {
+            TriggerEvent* event = game->triggerManager.GetEvent(m_triggerType);
+            if (event != nullptr)
+            {
+                event->Unsubscribe(this);
+            }
             break;
+        }
     }
 
     m_owner->activatedTrigger = nullptr;
@@ -304,6 +243,15 @@ void Trigger::ValidateTriggers(Game* game, Entity* source, SequenceType type)
     }
 }
 
+void Trigger::Invoke(Player* player, Entity* source)
+{
+    if (percentage == 1.0f ||
+        player->GetGame()->random.Get(0.0f, 1.0f) < percentage)
+    {
+        Process(player, source);
+    }
+}
+
 void Trigger::Process(Player* player, Entity* source)
 {
     if (m_sequenceType == SequenceType::NONE)
@@ -328,8 +276,14 @@ void Trigger::ProcessInternal(Entity* source)
         Remove();
     }
 
-    for (auto& task : tasks)
+    for (auto& prototype : tasks)
     {
+        // NOTE: The tasks are shared by all triggers of the card, so the task
+        // to enqueue is cloned not to be changed by another trigger.
+        ITask* task = fastExecution
+                          ? prototype
+                          : prototype->Clone(m_owner->owner->GetArena());
+
         task->SetPlayer(m_owner->owner);
         task->SetSource(m_owner);
 
@@ -0,0 +1,184 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Commons/SpinLocks.hpp>
+#include <Rosetta/Games/BatchRunner.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace RosettaStone
+{
+BatchRunner::BatchRunner(PolicyFactory player1Policy,
+                         PolicyFactory player2Policy, std::size_t numThreads)
+    : m_player1Policy(std::move(player1Policy)),
+      m_player2Policy(std::move(player2Policy)),
+      m_numThreads(numThreads)
+{
+    if (m_numThreads == 0)
+    {
+        m_numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+std::size_t BatchRunner::GetNumThreads() const
+{
+    return m_numThreads;
+}
+
+std::vector<GameResult> BatchRunner::Run(
+    const std::vector<GameConfig>& configs) const
+{
+    return Run(configs.size(), [&](std::size_t idx) {
+        Game game(configs[idx]);
+        return Play(game);
+    });
+}
+
+std::vector<GameResult> BatchRunner::Run(
+    const GameConfig& config, const std::vector<std::uint64_t>& seeds) const
+{
+    return Run(seeds.size(), [&](std::size_t idx) {
+        Game game(config);
+        game.random.Seed(seeds[idx]);
+        return Play(game);
+    });
+}
+
+std::vector<GameResult> BatchRunner::Run(
+    std::size_t numGames,
+    const std::function<GameResult(std::size_t)>& play) const
+{
+    struct WorkRange
+    {
+        SpinLock lock;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+    };
+
+    std::vector<GameResult> results(numGames);
+
+    const std::size_t numWorkers = std::min(m_numThreads, numGames);
+    if (numWorkers == 0)
+    {
+        return results;
+    }
+
+    // Give each worker a contiguous range of games
+    std::vector<WorkRange> ranges(numWorkers);
+    for (std::size_t i = 0; i < numWorkers; ++i)
+    {
+        ranges[i].begin = numGames * i / numWorkers;
+        ranges[i].end = numGames * (i + 1) / numWorkers;
+    }
+
+    // Takes the next game from its own range, or steals the latter half of
+    // the remaining games from the other workers
+    const auto takeGame = [&](std::size_t worker, std::size_t& idx) {
+        WorkRange& own = ranges[worker];
+
+        {
+            std::lock_guard<SpinLock> lock(own.lock);
+            if (own.begin < own.end)
+            {
+                idx = own.begin++;
+                return true;
+            }
+        }
+
+        for (std::size_t i = 1; i < numWorkers; ++i)
+        {
+            WorkRange& victim = ranges[(worker + i) % numWorkers];
+            std::size_t begin, end;
+
+            {
+                std::lock_guard<SpinLock> lock(victim.lock);
+                if (victim.begin == victim.end)
+                {
+                    continue;
+                }
+
+                begin = victim.end - (victim.end - victim.begin + 1) / 2;
+                end = victim.end;
+                victim.end = begin;
+            }
+
+            std::lock_guard<SpinLock> lock(own.lock);
+            own.begin = begin + 1;
+            own.end = end;
+            idx = begin;
+            return true;
+        }
+
+        return false;
+    };
+
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+
+    std::vector<std::thread> threads;
+    threads.reserve(numWorkers);
+
+    for (std::size_t worker = 0; worker < numWorkers; ++worker)
+    {
+        threads.emplace_back([&, worker]() {
+            try
+            {
+                std::size_t idx;
+                while (takeGame(worker, idx))
+                {
+                    results[idx] = play(idx);
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!exception)
+                {
+                    exception = std::current_exception();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+
+    return results;
+}
+
+GameResult BatchRunner::Play(Game& game) const
+{
+    const std::unique_ptr<IPolicy> player1Policy = m_player1Policy();
+    const std::unique_ptr<IPolicy> player2Policy = m_player2Policy();
+    game.GetPlayer1().policy = player1Policy.get();
+    game.GetPlayer2().policy = player2Policy.get();
+
+    const auto start = std::chrono::steady_clock::now();
+    game.PlayPolicy();
+    const auto end = std::chrono::steady_clock::now();
+
+    GameResult result;
+    result.player1State = game.GetPlayer1().playState;
+    result.player2State = game.GetPlayer2().playState;
+    result.turns = game.GetTurn();
+    result.elapsedTime =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+    result.taskProfiler = std::move(game.GetTaskProfiler());
+
+    return result;
+}
+}  // namespace RosettaStone
@@ -12,6 +12,7 @@
 #include <Rosetta/Enchants/Power.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Games/GameManager.hpp>
+#include <Rosetta/Models/Enchantment.hpp>
 #include <Rosetta/Policies/Policy.hpp>
 #include <Rosetta/Tasks/ITask.hpp>
 #include <Rosetta/Tasks/PlayerTasks/AttackTask.hpp>
@@ -21,17 +22,28 @@
 #include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
 #include <Rosetta/Views/BoardRefView.hpp>
 
-#include <effolkronium/random.hpp>
-
 #include <algorithm>
+#include <functional>
 
-using Random = effolkronium::random_static;
 using namespace RosettaStone::PlayerTasks;
 
 namespace RosettaStone
 {
-Game::Game(const GameConfig& gameConfig) : m_gameConfig(gameConfig)
+Game::Game(const GameConfig& gameConfig)
+    : random(gameConfig.seed ? Random(*gameConfig.seed) : Random()),
+      m_gameConfig(std::make_shared<GameConfig>(gameConfig)),
+      m_autoRun(gameConfig.autoRun)
 {
+    // Reverse card order in deck. It is done before the game starts because
+    // the decks are shared with the copies of the game.
+    if (!m_gameConfig->doShuffle)
+    {
+        std::reverse(m_gameConfig->player1Deck.begin(),
+                     m_gameConfig->player1Deck.end());
+        std::reverse(m_gameConfig->player2Deck.begin(),
+                     m_gameConfig->player2Deck.end());
+    }
+
     // Set game to player
     for (auto& p : m_players)
     {
@@ -55,6 +67,174 @@ Game::Game(const GameConfig& gameConfig) : m_gameConfig(gameConfig)
     GetPlayer2().opponent = &GetPlayer1();
 }
 
+Game::Game(const Game& rhs)
+    : state(rhs.state),
+      step(rhs.step),
+      nextStep(rhs.nextStep),
+      random(rhs.random),
+      m_gameConfig(rhs.m_gameConfig),
+      m_autoRun(rhs.m_autoRun),
+      m_turn(rhs.m_turn),
+      m_entityID(rhs.m_entityID),
+      m_oopIndex(rhs.m_oopIndex)
+{
+    std::map<const Entity*, Entity*> entities;
+    std::vector<std::pair<const Entity*, Entity*>> clonedEntities;
+
+    std::function<Entity*(const Entity*)> cloneEntity =
+        [&](const Entity* entity) -> Entity* {
+        if (entity == nullptr)
+        {
+            return nullptr;
+        }
+
+        const auto iter = entities.find(entity);
+        if (iter != entities.end())
+        {
+            return iter->second;
+        }
+
+        Player& owner =
+            m_players[entity->owner == &rhs.m_players[0] ? 0 : 1];
+        Entity* clone = entity->Clone(owner);
+
+        entities.emplace(entity, clone);
+        clonedEntities.emplace_back(entity, clone);
+
+        for (std::size_t i = 0; i < entity->chooseOneCard.size(); ++i)
+        {
+            clone->chooseOneCard[i] = cloneEntity(entity->chooseOneCard[i]);
+        }
+
+        for (auto& enchantment : entity->appliedEnchantments)
+        {
+            clone->appliedEnchantments.emplace_back(
+                dynamic_cast<Enchantment*>(cloneEntity(enchantment)));
+        }
+
+        if (const auto enchantment = dynamic_cast<const Enchantment*>(entity))
+        {
+            dynamic_cast<Enchantment*>(clone)->SetTarget(
+                cloneEntity(enchantment->GetTarget()));
+        }
+
+        if (const auto hero = dynamic_cast<const Hero*>(entity))
+        {
+            const auto heroClone = dynamic_cast<Hero*>(clone);
+            heroClone->heroPower =
+                dynamic_cast<HeroPower*>(cloneEntity(hero->heroPower));
+            heroClone->weapon =
+                dynamic_cast<Weapon*>(cloneEntity(hero->weapon));
+        }
+
+        return clone;
+    };
+
+    const auto findEntity = [&entities](const Entity* entity) -> Entity* {
+        const auto iter = entities.find(entity);
+        return iter != entities.end() ? iter->second : nullptr;
+    };
+
+    // Copy players and their entities
+    for (std::size_t i = 0; i < m_players.size(); ++i)
+    {
+        m_players[i].SetGame(this);
+        m_players[i].CopyFrom(rhs.m_players[i], cloneEntity);
+    }
+    GetPlayer1().opponent = &GetPlayer2();
+    GetPlayer2().opponent = &GetPlayer1();
+
+    if (rhs.m_firstPlayer != nullptr)
+    {
+        m_firstPlayer =
+            &m_players[rhs.m_firstPlayer == &rhs.m_players[0] ? 0 : 1];
+    }
+    if (rhs.m_currentPlayer != nullptr)
+    {
+        m_currentPlayer =
+            &m_players[rhs.m_currentPlayer == &rhs.m_players[0] ? 0 : 1];
+    }
+
+    // Activate triggers in order of play
+    std::stable_sort(clonedEntities.begin(), clonedEntities.end(),
+                     [](const auto& left, const auto& right) {
+                         return left.first->orderOfPlay <
+                                right.first->orderOfPlay;
+                     });
+    for (auto& [entity, clone] : clonedEntities)
+    {
+        if (entity->activatedTrigger != nullptr)
+        {
+            entity->activatedTrigger->Activate(clone, TriggerActivation::PLAY,
+                                               true);
+        }
+    }
+
+    // Copy auras
+    std::map<const IAura*, IAura*> clonedAuras;
+    for (auto& aura : rhs.auras)
+    {
+        IAura* clone = aura->Copy(entities);
+        auras.emplace_back(clone);
+        clonedAuras.emplace(aura, clone);
+    }
+    for (auto& [entity, clone] : clonedEntities)
+    {
+        if (entity->onGoingEffect != nullptr)
+        {
+            const auto iter = clonedAuras.find(entity->onGoingEffect);
+            if (iter != clonedAuras.end())
+            {
+                clone->onGoingEffect = iter->second;
+            }
+        }
+    }
+    for (std::size_t i = 0; i < m_players.size(); ++i)
+    {
+        for (auto& aura : rhs.m_players[i].GetFieldZone().auras)
+        {
+            m_players[i].GetFieldZone().auras.emplace_back(
+                dynamic_cast<Aura*>(clonedAuras.at(aura)));
+        }
+        for (auto& aura : rhs.m_players[i].GetHandZone().auras)
+        {
+            m_players[i].GetHandZone().auras.emplace_back(
+                dynamic_cast<Aura*>(clonedAuras.at(aura)));
+        }
+    }
+
+    // Copy effects and minions that are waiting to be processed
+    for (auto& [entity, effect] : rhs.oneTurnEffects)
+    {
+        oneTurnEffects.emplace_back(entities.at(entity), new Effect(*effect));
+    }
+    for (auto& minion : rhs.summonedMinions)
+    {
+        summonedMinions.emplace_back(dynamic_cast<Minion*>(findEntity(minion)));
+    }
+    for (auto& [oop, minion] : rhs.deadMinions)
+    {
+        deadMinions.emplace(oop, dynamic_cast<Minion*>(findEntity(minion)));
+    }
+
+    // Copy task stack and task queue
+    for (auto& entity : rhs.taskStack.entities)
+    {
+        taskStack.entities.emplace_back(findEntity(entity));
+    }
+    taskStack.source = findEntity(rhs.taskStack.source);
+    taskStack.target = findEntity(rhs.taskStack.target);
+    taskStack.num = rhs.taskStack.num;
+    taskStack.num1 = rhs.taskStack.num1;
+    taskStack.flag = rhs.taskStack.flag;
+
+    taskQueue.CopyFrom(rhs.taskQueue, *this, entities);
+
+    // The entities are added to the hash again while they are copied, so the
+    // hash is copied after all of them
+    zobristHash = rhs.zobristHash;
+}
+
 void Game::RefCopyFrom(const Game& rhs)
 {
     state = rhs.state;
@@ -65,6 +245,9 @@ void Game::RefCopyFrom(const Game& rhs)
     taskQueue = rhs.taskQueue;
     taskStack = rhs.taskStack;
     triggerManager = rhs.triggerManager;
+    zobristHash = rhs.zobristHash;
+
+    random = rhs.random;
 
     auras = rhs.auras;
     triggers = rhs.triggers;
@@ -73,6 +256,7 @@ void Game::RefCopyFrom(const Game& rhs)
     deadMinions = rhs.deadMinions;
 
     m_gameConfig = rhs.m_gameConfig;
+    m_autoRun = rhs.m_autoRun;
 
     m_players[0].RefCopy(rhs.m_players[0]);
     m_players[1].RefCopy(rhs.m_players[1]);
@@ -85,6 +269,16 @@ void Game::RefCopyFrom(const Game& rhs)
     m_currentPlayer = rhs.m_currentPlayer;
 }
 
+std::unique_ptr<Game> Game::Clone() const
+{
+    return std::unique_ptr<Game>(new Game(*this));
+}
+
+const GameConfig& Game::GetGameConfig() const
+{
+    return *m_gameConfig;
+}
+
 Player& Game::GetPlayer1()
 {
     return m_players[0];
@@ -134,16 +328,12 @@ void Game::BeginFirst()
 {
     // Set next step
     nextStep = Step::BEGIN_SHUFFLE;
-    if (m_gameConfig.autoRun)
-    {
-        GameManager::ProcessNextStep(*this, nextStep);
-    }
 }
 
 void Game::BeginShuffle()
 {
     // Shuffle cards in deck
-    if (m_gameConfig.doShuffle)
+    if (m_gameConfig->doShuffle)
     {
         GetPlayer1().GetDeckZone().Shuffle();
         GetPlayer2().GetDeckZone().Shuffle();
@@ -151,10 +341,6 @@ void Game::BeginShuffle()
 
     // Set next step
     nextStep = Step::BEGIN_DRAW;
-    if (m_gameConfig.autoRun)
-    {
-        GameManager::ProcessNextStep(*this, nextStep);
-    }
 }
 
 void Game::BeginDraw()
@@ -179,11 +365,7 @@ void Game::BeginDraw()
 
     // Set next step
     nextStep =
-        m_gameConfig.skipMulligan ? Step::MAIN_BEGIN : Step::BEGIN_MULLIGAN;
-    if (m_gameConfig.autoRun)
-    {
-        GameManager::ProcessNextStep(*this, nextStep);
-    }
+        m_gameConfig->skipMulligan ? Step::MAIN_BEGIN : Step::BEGIN_MULLIGAN;
 }
 
 void Game::BeginMulligan()
@@ -194,11 +376,11 @@ void Game::BeginMulligan()
 
     // Collect cards that can redraw
     std::vector<std::size_t> p1HandIDs, p2HandIDs;
-    for (auto& entity : GetPlayer1().GetHandZone().GetAll())
+    for (auto& entity : GetPlayer1().GetHandZone().GetAlive())
     {
         p1HandIDs.emplace_back(entity->id);
     }
-    for (auto& entity : GetPlayer2().GetHandZone().GetAll())
+    for (auto& entity : GetPlayer2().GetHandZone().GetAlive())
     {
         p2HandIDs.emplace_back(entity->id);
     }
@@ -217,10 +399,6 @@ void Game::MainBegin()
 
     // Set next step
     nextStep = Step::MAIN_READY;
-    if (m_gameConfig.autoRun)
-    {
-        GameManager::ProcessNextStep(*this, nextStep);
-    }
 }
 
 void Game::MainReady()
@@ -229,7 +407,7 @@ void Game::MainReady()
     for (auto& p : m_players)
     {
         // Field
-        for (auto& m : p.GetFieldZone().GetAll())
+        for (auto& m : p.GetFieldZone().GetAlive())
         {
             m->SetNumAttacksThisTurn(0);
         }
@@ -253,7 +431,7 @@ void Game::MainReady()
     // Hero power
     curPlayer.GetHero()->heroPower->SetExhausted(false);
     // Field
-    for (auto& m : curPlayer.GetFieldZone().GetAll())
+    for (auto& m : curPlayer.GetFieldZone().GetAlive())
     {
         m->SetExhausted(false);
     }
@@ -263,10 +441,6 @@ void Game::MainReady()
 
     // Set next step
     nextStep = Step::MAIN_START_TRIGGERS;
-    if (m_gameConfig.autoRun)
-    {
-        GameManager::ProcessNextStep(*this, nextStep);
-    }
 }
 
 void Game::MainStartTriggers()
@@ -277,10 +451,6 @@ void Game::MainStartTriggers()
 
     // Set next step
     nextStep = Step::MAIN_RESOURCE;
-    if (m_gameConfig.autoRun)
-    {
-        GameManager::ProcessNextStep(*this, nextStep);
-    }
 }
 
 void Game::MainResource()
@@ -301,10 +471,6 @@ void Game::MainResource()
 
     // Set next step
     nextStep = Step::MAIN_DRAW;
-    if (m_gameConfig.autoRun)
-    {
-        GameManager::ProcessNextStep(*this, nextStep);
-    }
 }
 
 void Game::MainDraw()
@@ -314,20 +480,12 @@ void Game::MainDraw()
 
     // Set next step
     nextStep = Step::MAIN_START;
-    if (m_gameConfig.autoRun)
-    {
-        GameManager::ProcessNextStep(*this, nextStep);
-    }
 }
 
 void Game::MainStart()
 {
     // Set next step
     nextStep = Step::MAIN_ACTION;
-    if (m_gameConfig.autoRun)
-    {
-        GameManager::ProcessNextStep(*this, nextStep);
-    }
 }
 
 void Game::MainAction()
@@ -345,10 +503,6 @@ void Game::MainEnd()
 
     // Set next step
     nextStep = Step::MAIN_CLEANUP;
-    if (m_gameConfig.autoRun)
-    {
-        GameManager::ProcessNextStep(*this, nextStep);
-    }
 }
 
 void Game::MainCleanUp()
@@ -375,7 +529,7 @@ void Game::MainCleanUp()
         curPlayer.GetHero()->SetGameTag(GameTag::FROZEN, 0);
     }
     // Field
-    for (auto& m : curPlayer.GetFieldZone().GetAll())
+    for (auto& m : curPlayer.GetFieldZone().GetAlive())
     {
         if (m->GetGameTag(GameTag::FROZEN) == 1 &&
             m->GetNumAttacksThisTurn() == 0 && !m->IsExhausted())
@@ -386,10 +540,6 @@ void Game::MainCleanUp()
 
     // Set next step
     nextStep = Step::MAIN_NEXT;
-    if (m_gameConfig.autoRun)
-    {
-        GameManager::ProcessNextStep(*this, nextStep);
-    }
 }
 
 void Game::MainNext()
@@ -402,10 +552,6 @@ void Game::MainNext()
 
     // Set next step
     nextStep = Step::MAIN_READY;
-    if (m_gameConfig.autoRun)
-    {
-        GameManager::ProcessNextStep(*this, nextStep);
-    }
 }
 
 void Game::FinalWrapUp()
@@ -423,7 +569,6 @@ void Game::FinalWrapUp()
 
     // Set next step
     nextStep = Step::FINAL_GAMEOVER;
-    GameManager::ProcessNextStep(*this, nextStep);
 }
 
 void Game::FinalGameOver()
@@ -434,17 +579,8 @@ void Game::FinalGameOver()
 
 void Game::StartGame()
 {
-    // Reverse card order in deck
-    if (!m_gameConfig.doShuffle)
-    {
-        std::reverse(m_gameConfig.player1Deck.begin(),
-                     m_gameConfig.player1Deck.end());
-        std::reverse(m_gameConfig.player2Deck.begin(),
-                     m_gameConfig.player2Deck.end());
-    }
-
     // Set up decks
-    for (auto& card : m_gameConfig.player1Deck)
+    for (auto& card : m_gameConfig->player1Deck)
     {
         if (card.id.empty())
         {
@@ -455,7 +591,7 @@ void Game::StartGame()
                                              &GetPlayer1().GetDeckZone());
         GetPlayer1().GetDeckZone().Add(*entity);
     }
-    for (auto& card : m_gameConfig.player2Deck)
+    for (auto& card : m_gameConfig->player2Deck)
     {
         if (card.id.empty())
         {
@@ -468,11 +604,11 @@ void Game::StartGame()
     }
 
     // Fill cards to deck
-    if (m_gameConfig.doFillDecks)
+    if (m_gameConfig->doFillDecks)
     {
         for (auto& p : m_players)
         {
-            for (auto& cardID : m_gameConfig.fillCardIDs)
+            for (auto& cardID : m_gameConfig->fillCardIDs)
             {
                 Card* card = Cards::FindCardByID(cardID);
                 Entity* entity = Entity::GetFromCard(p, card);
@@ -489,11 +625,11 @@ void Game::StartGame()
     }
 
     // Determine first player
-    switch (m_gameConfig.startPlayer)
+    switch (m_gameConfig->startPlayer)
     {
         case PlayerType::RANDOM:
         {
-            const auto val = Random::get(0, 1);
+            const auto val = random.Get(0, 1);
             m_firstPlayer = &m_players[val];
             break;
         }
@@ -511,9 +647,9 @@ void Game::StartGame()
 
     // Set next step
     nextStep = Step::BEGIN_FIRST;
-    if (m_gameConfig.autoRun)
+    if (m_autoRun)
     {
-        GameManager::ProcessNextStep(*this, nextStep);
+        ProcessSteps();
     }
 }
 
@@ -530,7 +666,7 @@ void Game::ProcessDestroyAndUpdateAura()
     UpdateAura();
 
     // Process summoned minions
-    if (triggerManager.summonTrigger != nullptr)
+    if (!triggerManager.summonTrigger.IsEmpty())
     {
         taskQueue.StartEvent();
         for (auto& minion : summonedMinions)
@@ -611,6 +747,7 @@ void Game::UpdateAura()
 PlayState Game::Process(Player& player, ITask* task)
 {
     // Process task
+    const Step prevNextStep = nextStep;
     task->SetPlayer(&player);
     Task::Run(task);
 
@@ -619,25 +756,46 @@ PlayState Game::Process(Player& player, ITask* task)
         delete task;
     }
 
-    return CheckGameOver();
+    ProcessTaskSteps(prevNextStep);
+
+    return GetCurrentPlayer().playState;
 }
 
 PlayState Game::Process(Player& player, ITask&& task)
 {
     // Process task
+    const Step prevNextStep = nextStep;
     task.SetPlayer(&player);
     Task::Run(std::move(task));
 
-    return CheckGameOver();
+    ProcessTaskSteps(prevNextStep);
+
+    return GetCurrentPlayer().playState;
 }
 
-void Game::ProcessUntil(Step untilStep)
+void Game::ProcessTaskSteps(Step prevNextStep)
 {
-    m_gameConfig.autoRun = false;
-    while (nextStep != untilStep)
+    // Finish the game if it is over in the task
+    if (CheckGameOver())
     {
-        GameManager::ProcessNextStep(*this, nextStep);
+        RunSteps(Step::INVALID, false);
     }
+    // Run the steps that the task has moved the game to
+    else if (nextStep != prevNextStep)
+    {
+        ProcessSteps();
+    }
+}
+
+void Game::ProcessSteps()
+{
+    RunSteps(Step::INVALID, m_autoRun);
+}
+
+void Game::ProcessUntil(Step untilStep)
+{
+    m_autoRun = false;
+    RunSteps(untilStep, true);
 }
 
 void Game::PlayPolicy()
@@ -662,7 +820,8 @@ void Game::PlayPolicy()
             PlayerTasks::ChooseTask::Mulligan(
                 player2, p2Choice.GetObject<std::vector<std::size_t>>()));
 
-    MainReady();
+    nextStep = Step::MAIN_READY;
+    ProcessSteps();
 
     while (state != State::COMPLETE)
     {
@@ -709,7 +868,8 @@ PlayState Game::PerformAction(ActionParams& params)
                     chooseOne = 2;
                 }
             }
-            task = new PlayCardTask(card, target, fieldPos, chooseOne);
+            task = new (&m_arena)
+                PlayCardTask(card, target, fieldPos, chooseOne);
             break;
         }
         case MainOpType::ATTACK:
@@ -717,7 +877,7 @@ PlayState Game::PerformAction(ActionParams& params)
             Character* source = params.GetAttacker();
             Character* target = params.GetSpecifiedTarget(
                 source->GetValidCombatTargets(*GetCurrentPlayer().opponent));
-            task = new AttackTask(source, target);
+            task = new (&m_arena) AttackTask(source, target);
             break;
         }
         case MainOpType::USE_HERO_POWER:
@@ -725,12 +885,12 @@ PlayState Game::PerformAction(ActionParams& params)
             Hero* hero = GetCurrentPlayer().GetHero();
             Character* target = params.GetSpecifiedTarget(
                 Generic::GetValidTargets(hero->heroPower));
-            task = new HeroPowerTask(target);
+            task = new (&m_arena) HeroPowerTask(target);
             break;
         }
         case MainOpType::END_TURN:
         {
-            task = new EndTurnTask();
+            task = new (&m_arena) EndTurnTask();
             break;
         }
     }
@@ -751,8 +911,65 @@ ReducedBoardView Game::CreateView() const
     }
 }
 
-PlayState Game::CheckGameOver()
+std::uint64_t Game::GetHash(PlayerType viewer) const
 {
+    return zobristHash.GetHash(viewer, GetTurn(),
+                               m_currentPlayer != nullptr
+                                   ? m_currentPlayer->playerType
+                                   : PlayerType::PLAYER1);
+}
+
+TaskProfiler& Game::GetTaskProfiler()
+{
+    return taskQueue.GetProfiler();
+}
+
+const TaskProfiler& Game::GetTaskProfiler() const
+{
+    return taskQueue.GetProfiler();
+}
+
+Arena& Game::GetArena()
+{
+    return m_arena;
+}
+
+void Game::RunSteps(Step untilStep, bool autoRun)
+{
+    while (nextStep != untilStep)
+    {
+        const Step curStep = nextStep;
+        GameManager::ProcessNextStep(*this, curStep);
+
+        // The step sets its own next step even if the game is over in it
+        if (curStep != Step::FINAL_WRAPUP && curStep != Step::FINAL_GAMEOVER)
+        {
+            CheckGameOver();
+        }
+
+        // The step that waits for the input of player or the end of the game
+        // keeps the next step
+        if (nextStep == curStep)
+        {
+            break;
+        }
+
+        // The steps to finish the game are processed even if auto run is off
+        if (!autoRun && nextStep != Step::FINAL_WRAPUP &&
+            nextStep != Step::FINAL_GAMEOVER)
+        {
+            break;
+        }
+    }
+}
+
+bool Game::CheckGameOver()
+{
+    if (state == State::COMPLETE)
+    {
+        return false;
+    }
+
     // Check hero of two players is destroyed
     if (GetPlayer1().GetHero()->isDestroyed)
     {
@@ -765,20 +982,19 @@ PlayState Game::CheckGameOver()
         {
             GetPlayer1().playState = PlayState::LOSING;
         }
-
-        // Set next step
-        nextStep = Step::FINAL_WRAPUP;
-        GameManager::ProcessNextStep(*this, nextStep);
     }
     else if (GetPlayer2().GetHero()->isDestroyed)
     {
         GetPlayer2().playState = PlayState::LOSING;
-
-        // Set next step
-        nextStep = Step::FINAL_WRAPUP;
-        GameManager::ProcessNextStep(*this, nextStep);
+    }
+    else
+    {
+        return false;
     }
 
-    return GetCurrentPlayer().playState;
+    // Set next step
+    nextStep = Step::FINAL_WRAPUP;
+
+    return true;
 }
 }  // namespace RosettaStone
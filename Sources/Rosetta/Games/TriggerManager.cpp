@@ -4,112 +4,216 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Rosetta/Enchants/Trigger.hpp>
 #include <Rosetta/Games/TriggerManager.hpp>
+#include <Rosetta/Models/Entity.hpp>
 
 namespace RosettaStone
 {
-void TriggerManager::OnStartTurnTrigger(Player* player, Entity* sender) const
+void TriggerEvent::Subscribe(Trigger* trigger)
 {
-    if (startTurnTrigger != nullptr)
+    // Keep the order of play unless the trigger has a later owner
+    const bool isOrdered =
+        m_triggers.empty() || m_triggers.back() == nullptr ||
+        m_triggers.back()->m_owner->orderOfPlay <=
+            trigger->m_owner->orderOfPlay;
+
+    trigger->m_eventIndex = m_triggers.size();
+    m_triggers.emplace_back(trigger);
+    ++m_count;
+
+    if (!isOrdered)
     {
-        startTurnTrigger(player, sender);
+        m_isDirty = true;
     }
-}
 
-void TriggerManager::OnEndTurnTrigger(Player* player, Entity* sender) const
-{
-    if (endTurnTrigger != nullptr)
+    if (m_isDirty && m_depth == 0)
     {
-        endTurnTrigger(player, sender);
+        Compact();
     }
 }
 
-void TriggerManager::OnPlayCardTrigger(Player* player, Entity* sender) const
+void TriggerEvent::Unsubscribe(Trigger* trigger)
 {
-    if (playCardTrigger != nullptr)
+    const std::size_t idx = trigger->m_eventIndex;
+    if (idx >= m_triggers.size() || m_triggers[idx] != trigger)
     {
-        playCardTrigger(player, sender);
+        return;
     }
+
+    m_triggers[idx] = nullptr;
+    trigger->m_eventIndex = Trigger::INVALID_EVENT_INDEX;
+    --m_count;
+    m_isDirty = true;
 }
 
-void TriggerManager::OnAfterPlayMinionTrigger(Player* player,
-                                              Entity* sender) const
+void TriggerEvent::Invoke(Player* player, Entity* sender)
 {
-    if (afterPlayMinionTrigger != nullptr)
+    if (m_count == 0)
     {
-        afterPlayMinionTrigger(player, sender);
+        return;
     }
-}
 
-void TriggerManager::OnCastSpellTrigger(Player* player, Entity* sender) const
-{
-    if (castSpellTrigger != nullptr)
+    // The slots are never moved while the event is invoked
+    const std::size_t size = m_triggers.size();
+    ++m_depth;
+
+    for (std::size_t idx = 0; idx < size; ++idx)
     {
-        castSpellTrigger(player, sender);
+        Trigger* trigger = m_triggers[idx];
+        if (trigger != nullptr)
+        {
+            trigger->Invoke(player, sender);
+        }
     }
-}
 
-void TriggerManager::OnAfterCastTrigger(Player* player, Entity* sender) const
-{
-    if (afterCastTrigger != nullptr)
+    --m_depth;
+
+    if (m_isDirty && m_depth == 0)
     {
-        afterCastTrigger(player, sender);
+        Compact();
     }
 }
 
-void TriggerManager::OnHealTrigger(Player* player, Entity* sender) const
+bool TriggerEvent::IsEmpty() const
 {
-    if (healTrigger != nullptr)
-    {
-        healTrigger(player, sender);
-    }
+    return m_count == 0;
 }
 
-void TriggerManager::OnAttackTrigger(Player* player, Entity* sender) const
+std::size_t TriggerEvent::GetCount() const
 {
-    if (attackTrigger != nullptr)
-    {
-        attackTrigger(player, sender);
-    }
+    return m_count;
 }
 
-void TriggerManager::OnSummonTrigger(Player* player, Entity* sender) const
+void TriggerEvent::Compact()
 {
-    if (summonTrigger != nullptr)
+    std::size_t count = 0;
+
+    // Insertion sort is used because the triggers are almost sorted
+    for (std::size_t idx = 0; idx < m_triggers.size(); ++idx)
     {
-        summonTrigger(player, sender);
+        Trigger* trigger = m_triggers[idx];
+        if (trigger == nullptr)
+        {
+            continue;
+        }
+
+        std::size_t pos = count++;
+        while (pos > 0 && m_triggers[pos - 1]->m_owner->orderOfPlay >
+                              trigger->m_owner->orderOfPlay)
+        {
+            m_triggers[pos] = m_triggers[pos - 1];
+            --pos;
+        }
+        m_triggers[pos] = trigger;
     }
-}
 
-void TriggerManager::OnAfterSummonTrigger(Player* player, Entity* sender) const
-{
-    if (afterSummonTrigger != nullptr)
+    m_triggers.resize(count);
+    for (std::size_t idx = 0; idx < count; ++idx)
     {
-        afterSummonTrigger(player, sender);
+        m_triggers[idx]->m_eventIndex = idx;
     }
+
+    m_isDirty = false;
 }
 
-void TriggerManager::OnDealDamageTrigger(Player* player, Entity* sender) const
+void TriggerManager::OnStartTurnTrigger(Player* player, Entity* sender)
 {
-    if (dealDamageTrigger != nullptr)
-    {
-        dealDamageTrigger(player, sender);
-    }
+    startTurnTrigger.Invoke(player, sender);
 }
 
-void TriggerManager::OnTakeDamageTrigger(Player* player, Entity* sender) const
+void TriggerManager::OnEndTurnTrigger(Player* player, Entity* sender)
 {
-    if (takeDamageTrigger != nullptr)
-    {
-        takeDamageTrigger(player, sender);
-    }
+    endTurnTrigger.Invoke(player, sender);
+}
+
+void TriggerManager::OnPlayCardTrigger(Player* player, Entity* sender)
+{
+    playCardTrigger.Invoke(player, sender);
+}
+
+void TriggerManager::OnAfterPlayMinionTrigger(Player* player, Entity* sender)
+{
+    afterPlayMinionTrigger.Invoke(player, sender);
+}
+
+void TriggerManager::OnCastSpellTrigger(Player* player, Entity* sender)
+{
+    castSpellTrigger.Invoke(player, sender);
+}
+
+void TriggerManager::OnAfterCastTrigger(Player* player, Entity* sender)
+{
+    afterCastTrigger.Invoke(player, sender);
+}
+
+void TriggerManager::OnHealTrigger(Player* player, Entity* sender)
+{
+    healTrigger.Invoke(player, sender);
+}
+
+void TriggerManager::OnAttackTrigger(Player* player, Entity* sender)
+{
+    attackTrigger.Invoke(player, sender);
+}
+
+void TriggerManager::OnSummonTrigger(Player* player, Entity* sender)
+{
+    summonTrigger.Invoke(player, sender);
+}
+
+void TriggerManager::OnAfterSummonTrigger(Player* player, Entity* sender)
+{
+    afterSummonTrigger.Invoke(player, sender);
+}
+
+void TriggerManager::OnDealDamageTrigger(Player* player, Entity* sender)
+{
+    dealDamageTrigger.Invoke(player, sender);
+}
+
+void TriggerManager::OnTakeDamageTrigger(Player* player, Entity* sender)
+{
+    takeDamageTrigger.Invoke(player, sender);
+}
+
+void TriggerManager::OnTargetTrigger(Player* player, Entity* sender)
+{
+    targetTrigger.Invoke(player, sender);
 }
 
-void TriggerManager::OnTargetTrigger(Player* player, Entity* sender) const
+TriggerEvent* TriggerManager::GetEvent(TriggerType type)
 {
-    if (targetTrigger != nullptr)
+    switch (type)
     {
-        targetTrigger(player, sender);
+        case TriggerType::TURN_START:
+            return &startTurnTrigger;
+        case TriggerType::TURN_END:
+            return &endTurnTrigger;
+        case TriggerType::PLAY_CARD:
+            return &playCardTrigger;
+        case TriggerType::AFTER_PLAY_MINION:
+            return &afterPlayMinionTrigger;
+        case TriggerType::CAST_SPELL:
+            return &castSpellTrigger;
+        case TriggerType::AFTER_CAST:
+            return &afterCastTrigger;
+        case TriggerType::HEAL:
+            return &healTrigger;
+        case TriggerType::ATTACK:
+            return &attackTrigger;
+        case TriggerType::SUMMON:
+            return &summonTrigger;
+        case TriggerType::AFTER_SUMMON:
+            return &afterSummonTrigger;
+        case TriggerType::DEAL_DAMAGE:
+            return &dealDamageTrigger;
+        case TriggerType::TAKE_DAMAGE:
+            return &takeDamageTrigger;
+        case TriggerType::TARGET:
+            return &targetTrigger;
+        default:
+            return nullptr;
     }
 }
 }  // namespace RosettaStone
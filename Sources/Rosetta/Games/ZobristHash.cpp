@@ -0,0 +1,151 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Commons/Utils.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/ZobristHash.hpp>
+#include <Rosetta/Models/Entity.hpp>
+
+namespace RosettaStone
+{
+//! The salts that separate the kinds of values added to the hash.
+constexpr std::uint64_t CARD_SALT = 0x8f1bbcdcca62c1d6;
+constexpr std::uint64_t HAND_SALT = 0x5a827999ed9eba14;
+constexpr std::uint64_t DECK_SALT = 0x6ed9eba18f1bbcdc;
+constexpr std::uint64_t SECRET_SALT = 0xca62c1d65a827999;
+constexpr std::uint64_t PLAYER_SALT = 0x243f6a8885a308d3;
+constexpr std::uint64_t VIEWER_SALT = 0x13198a2e03707344;
+constexpr std::uint64_t TURN_SALT = 0xa4093822299f31d0;
+constexpr std::uint64_t CURRENT_SALT = 0x082efa98ec4e6c89;
+
+//! Returns the index of player with given \p playerType.
+//! \param playerType The player type.
+//! \return The index of player.
+constexpr std::size_t GetPlayerIdx(PlayerType playerType)
+{
+    return playerType == PlayerType::PLAYER2 ? 1 : 0;
+}
+
+//! Returns the value that is added to the hash for each entity that only the
+//! number of it is known.
+//! \param salt The salt of the zone.
+//! \param playerIdx The index of the owner.
+//! \return The value for each entity.
+constexpr std::uint64_t HashCount(std::uint64_t salt, std::size_t playerIdx)
+{
+    return MixHash(salt + playerIdx);
+}
+
+void ZobristHash::AddEntity(Entity& entity)
+{
+    RemoveEntity(entity);
+
+    HashScope scope;
+    switch (entity.GetZoneType())
+    {
+        case ZoneType::PLAY:
+            scope = HashScope::PUBLIC;
+            break;
+        case ZoneType::HAND:
+            scope = HashScope::HAND;
+            break;
+        case ZoneType::DECK:
+            scope = HashScope::DECK;
+            break;
+        case ZoneType::SECRET:
+            scope = HashScope::SECRET;
+            break;
+        default:
+            return;
+    }
+
+    const std::size_t playerIdx = GetPlayerIdx(entity.owner->playerType);
+    const std::uint64_t cardHash =
+        entity.card != nullptr
+            ? MixHash(CARD_SALT + static_cast<std::uint64_t>(entity.card->dbfID))
+            : 0;
+    const std::uint64_t value = MixHash(entity.GetGameTagHash() ^ cardHash);
+
+    switch (scope)
+    {
+        case HashScope::PUBLIC:
+            m_public += value;
+            break;
+        case HashScope::HAND:
+            m_hidden[playerIdx] += value;
+            m_public += HashCount(HAND_SALT, playerIdx);
+            break;
+        case HashScope::DECK:
+            m_public += HashCount(DECK_SALT, playerIdx);
+            break;
+        case HashScope::SECRET:
+            m_hidden[playerIdx] += value;
+            m_public += HashCount(SECRET_SALT, playerIdx);
+            break;
+        default:
+            break;
+    }
+
+    entity.hashEntry = HashEntry{ scope, playerIdx, value };
+}
+
+void ZobristHash::RemoveEntity(Entity& entity)
+{
+    const HashEntry& entry = entity.hashEntry;
+
+    switch (entry.scope)
+    {
+        case HashScope::PUBLIC:
+            m_public -= entry.value;
+            break;
+        case HashScope::HAND:
+            m_hidden[entry.playerIdx] -= entry.value;
+            m_public -= HashCount(HAND_SALT, entry.playerIdx);
+            break;
+        case HashScope::DECK:
+            m_public -= HashCount(DECK_SALT, entry.playerIdx);
+            break;
+        case HashScope::SECRET:
+            m_hidden[entry.playerIdx] -= entry.value;
+            m_public -= HashCount(SECRET_SALT, entry.playerIdx);
+            break;
+        default:
+            return;
+    }
+
+    entity.hashEntry = HashEntry{};
+}
+
+void ZobristHash::UpdatePlayer(PlayerType playerType,
+                               std::uint64_t prevTagHash,
+                               std::uint64_t tagHash)
+{
+    const std::uint64_t salt = PLAYER_SALT + GetPlayerIdx(playerType);
+
+    m_public -= MixHash(salt ^ prevTagHash);
+    m_public += MixHash(salt ^ tagHash);
+}
+
+std::uint64_t ZobristHash::GetHash(PlayerType viewer, int turn,
+                                   PlayerType current) const
+{
+    const std::size_t viewerIdx = GetPlayerIdx(viewer);
+
+    return m_public + m_hidden[viewerIdx] + HashCount(VIEWER_SALT, viewerIdx) +
+           MixHash(TURN_SALT + static_cast<std::uint64_t>(turn)) +
+           HashCount(CURRENT_SALT, GetPlayerIdx(current));
+}
+
+void ZobristHash::Detach(Entity& entity)
+{
+    if (entity.hashEntry.scope == HashScope::NONE)
+    {
+        return;
+    }
+
+    entity.owner->GetGame()->zobristHash.RemoveEntity(entity);
+}
+}  // namespace RosettaStone
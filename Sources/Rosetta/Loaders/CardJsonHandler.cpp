@@ -0,0 +1,277 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Loaders/CardJsonHandler.hpp>
+
+namespace RosettaStone
+{
+//! The depth of the object that contains the data of a card.
+constexpr std::size_t CARD_OBJECT_DEPTH = 2;
+
+CardJsonHandler::CardJsonHandler(std::vector<Card*>& cards) : m_cards(cards)
+{
+    // Do nothing
+}
+
+CardJsonHandler::~CardJsonHandler()
+{
+    delete m_card;
+}
+
+bool CardJsonHandler::null()
+{
+    return true;
+}
+
+bool CardJsonHandler::boolean(bool val)
+{
+    if (!m_isSkipped && m_depth == CARD_OBJECT_DEPTH)
+    {
+        SetValue(val ? 1 : 0);
+    }
+
+    return true;
+}
+
+bool CardJsonHandler::number_integer(number_integer_t val)
+{
+    if (m_isSkipped)
+    {
+        return true;
+    }
+
+    if (m_depth == CARD_OBJECT_DEPTH)
+    {
+        SetValue(static_cast<int>(val));
+    }
+    else if (m_depth == CARD_OBJECT_DEPTH + 1 && m_key == "playRequirements")
+    {
+        m_card->playRequirements.try_emplace(StrToEnum<PlayReq>(m_innerKey),
+                                             static_cast<int>(val));
+    }
+
+    return true;
+}
+
+bool CardJsonHandler::number_unsigned(number_unsigned_t val)
+{
+    return number_integer(static_cast<number_integer_t>(val));
+}
+
+bool CardJsonHandler::number_float([[maybe_unused]] number_float_t val,
+                                   [[maybe_unused]] const string_t& s)
+{
+    return true;
+}
+
+bool CardJsonHandler::string(string_t& val)
+{
+    if (m_isSkipped)
+    {
+        return true;
+    }
+
+    if (m_depth == CARD_OBJECT_DEPTH)
+    {
+        SetValue(val);
+    }
+    else if (m_depth == CARD_OBJECT_DEPTH + 1)
+    {
+        if (m_key == "mechanics")
+        {
+            m_card->gameTags.emplace(StrToEnum<GameTag>(val), 1);
+        }
+        else if (m_key == "entourage")
+        {
+            m_card->entourages.emplace_back(std::move(val));
+        }
+    }
+
+    return true;
+}
+
+bool CardJsonHandler::start_object([[maybe_unused]] std::size_t elements)
+{
+    ++m_depth;
+
+    if (m_depth == CARD_OBJECT_DEPTH)
+    {
+        m_card = new Card();
+        m_card->dbfID = 0;
+        m_isSkipped = false;
+
+        // NOTE: These game tags are always set, and the values in cards.json
+        // override both the defaults and the mechanics with the same name.
+        m_card->gameTags = { { GameTag::ATK, 0 },
+                             { GameTag::CARDRACE, 0 },
+                             { GameTag::CARD_SET, 1 },
+                             { GameTag::CARDTYPE, 0 },
+                             { GameTag::CLASS, 0 },
+                             { GameTag::COLLECTIBLE, 0 },
+                             { GameTag::COST, 0 },
+                             { GameTag::DAMAGE, 0 },
+                             { GameTag::DURABILITY, 0 },
+                             { GameTag::FACTION, 0 },
+                             { GameTag::HEALTH, 0 },
+                             { GameTag::RARITY, 0 },
+                             { GameTag::SPELLPOWER, 0 },
+                             { GameTag::OVERLOAD, 0 } };
+    }
+
+    return true;
+}
+
+bool CardJsonHandler::key(string_t& val)
+{
+    if (m_depth == CARD_OBJECT_DEPTH)
+    {
+        m_key.swap(val);
+    }
+    else if (m_depth == CARD_OBJECT_DEPTH + 1)
+    {
+        m_innerKey.swap(val);
+    }
+
+    return true;
+}
+
+bool CardJsonHandler::end_object()
+{
+    if (m_depth == CARD_OBJECT_DEPTH)
+    {
+        if (m_isSkipped)
+        {
+            delete m_card;
+        }
+        else
+        {
+            // NOTE: Erase invalid mechanics 'FREEZE' of Frost Elemental
+            // (EX1_283)
+            if (m_card->name == "Frost Elemental")
+            {
+                m_card->gameTags[GameTag::FREEZE] = 0;
+            }
+
+            m_card->Initialize();
+            m_cards.emplace_back(m_card);
+        }
+
+        m_card = nullptr;
+        m_key.clear();
+    }
+
+    --m_depth;
+
+    return true;
+}
+
+bool CardJsonHandler::start_array([[maybe_unused]] std::size_t elements)
+{
+    ++m_depth;
+
+    return true;
+}
+
+bool CardJsonHandler::end_array()
+{
+    --m_depth;
+
+    return true;
+}
+
+bool CardJsonHandler::parse_error([[maybe_unused]] std::size_t position,
+                                  [[maybe_unused]] const std::string& lastToken,
+                                  const nlohmann::detail::exception& ex)
+{
+    throw std::runtime_error(std::string("Can't parse card data: ") +
+                             ex.what());
+}
+
+void CardJsonHandler::SetValue(int value)
+{
+    if (m_key == "dbfId")
+    {
+        m_card->dbfID = value;
+    }
+    else if (m_key == "attack")
+    {
+        m_card->gameTags[GameTag::ATK] = value;
+    }
+    else if (m_key == "collectible")
+    {
+        m_card->gameTags[GameTag::COLLECTIBLE] = value;
+    }
+    else if (m_key == "cost")
+    {
+        m_card->gameTags[GameTag::COST] = value;
+    }
+    else if (m_key == "durability")
+    {
+        m_card->gameTags[GameTag::DURABILITY] = value;
+    }
+    else if (m_key == "health")
+    {
+        m_card->gameTags[GameTag::HEALTH] = value;
+    }
+    else if (m_key == "spellDamage")
+    {
+        m_card->gameTags[GameTag::SPELLPOWER] = value;
+    }
+    else if (m_key == "overload")
+    {
+        m_card->gameTags[GameTag::OVERLOAD] = value;
+    }
+}
+
+void CardJsonHandler::SetValue(std::string& value)
+{
+    if (m_key == "id")
+    {
+        // NOTE: Check invalid card type for 'Placeholder'
+        // See https://hearthstone.gamepedia.com/Placeholder_Card
+        m_isSkipped = value == "PlaceholderCard";
+        m_card->id = std::move(value);
+    }
+    else if (m_key == "name")
+    {
+        m_card->name = std::move(value);
+    }
+    else if (m_key == "text")
+    {
+        m_card->text = std::move(value);
+    }
+    else if (m_key == "race")
+    {
+        m_card->gameTags[GameTag::CARDRACE] =
+            static_cast<int>(StrToEnum<Race>(value));
+    }
+    else if (m_key == "set")
+    {
+        m_card->gameTags[GameTag::CARD_SET] =
+            static_cast<int>(StrToEnum<CardSet>(value));
+    }
+    else if (m_key == "type")
+    {
+        m_card->gameTags[GameTag::CARDTYPE] =
+            static_cast<int>(StrToEnum<CardType>(value));
+    }
+    else if (m_key == "cardClass")
+    {
+        m_card->gameTags[GameTag::CLASS] =
+            static_cast<int>(StrToEnum<CardClass>(value));
+    }
+    else if (m_key == "faction")
+    {
+        m_card->gameTags[GameTag::FACTION] =
+            static_cast<int>(StrToEnum<Faction>(value));
+    }
+    else if (m_key == "rarity")
+    {
+        m_card->gameTags[GameTag::RARITY] =
+            static_cast<int>(StrToEnum<Rarity>(value));
+    }
+}
+}  // namespace RosettaStone
@@ -4,147 +4,364 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Rosetta/Commons/Constants.hpp>
+#include <Rosetta/Commons/Macros.hpp>
+#include <Rosetta/Loaders/CardJsonHandler.hpp>
 #include <Rosetta/Loaders/CardLoader.hpp>
 
+#include <sys/types.h>
+#include <sys/stat.h>
+#if !defined(ROSETTASTONE_WINDOWS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
+#include <iterator>
 
 namespace RosettaStone
 {
+//! The magic number of binary card data.
+constexpr char CARD_DATA_MAGIC[4] = { 'R', 'S', 'C', 'D' };
+
+//! The number of game tags and play requirements. Binary card data that is
+//! compiled with different enums can't be used.
+constexpr std::int32_t CARD_DATA_NUM_GAME_TAGS = 0
+#define X(a) +1
+#include <Rosetta/Enums/GameTag.def>
+#undef X
+    ;
+constexpr std::int32_t CARD_DATA_NUM_PLAY_REQS = 0
+#define X(a) +1
+#include <Rosetta/Enums/PlayReq.def>
+#undef X
+    ;
+
+//! The minimum size of a card in binary card data: the lengths of three
+//! strings, dbfID and the numbers of game tags, play requirements and
+//! entourages.
+constexpr std::ptrdiff_t CARD_DATA_MIN_CARD_SIZE = 7 * sizeof(std::int32_t);
+
 void CardLoader::Load(std::vector<Card*>& cards)
+{
+    const std::string binaryPath = RESOURCES_DIR "cards.bin";
+    const std::string jsonPath = RESOURCES_DIR "cards.json";
+
+    if (LoadFromBinary(binaryPath, jsonPath, cards))
+    {
+        return;
+    }
+
+    LoadFromJson(jsonPath, cards);
+}
+
+void CardLoader::LoadFromJson(const std::string& path,
+                              std::vector<Card*>& cards)
 {
     // Read card data from JSON file
-    std::ifstream cardFile(RESOURCES_DIR "cards.json");
-    nlohmann::json j;
+    std::ifstream cardFile(path);
 
     if (!cardFile.is_open())
     {
         throw std::runtime_error("Can't open cards.json");
     }
 
-    cardFile >> j;
+    // Parse card data without building the whole JSON document
+    CardJsonHandler handler(cards);
+    nlohmann::json::sax_parse(cardFile, &handler);
+
+    cardFile.close();
+}
+
+bool CardLoader::LoadFromBinary(const std::string& path,
+                                const std::string& jsonPath,
+                                std::vector<Card*>& cards)
+{
+    std::int64_t jsonSize = 0;
+    std::int64_t jsonModifiedTime = 0;
+    const bool hasJson = ReadStamp(jsonPath, jsonSize, jsonModifiedTime);
+
+    // Map binary card data to memory
+#if defined(ROSETTASTONE_WINDOWS)
+    std::ifstream cardFile(path, std::ios::binary);
+    if (!cardFile.is_open())
+    {
+        return false;
+    }
+
+    const std::vector<char> buffer((std::istreambuf_iterator<char>(cardFile)),
+                                   std::istreambuf_iterator<char>());
+    const char* data = buffer.data();
+    const std::size_t size = buffer.size();
+#else
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        close(fd);
+        return false;
+    }
 
-    cards.reserve(j.size());
+    const auto size = static_cast<std::size_t>(fileStat.st_size);
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
 
-    for (auto& cardData : j)
+    if (mapped == MAP_FAILED)
     {
-        const std::string id = cardData["id"].get<std::string>();
-        // NOTE: Check invalid card type for 'Placeholder'
-        // See https://hearthstone.gamepedia.com/Placeholder_Card
-        if (id == "PlaceholderCard")
+        return false;
+    }
+
+    const char* data = static_cast<const char*>(mapped);
+#endif
+
+    const char* pos = data;
+    const char* end = data + size;
+    bool isValid = true;
+
+    const auto readInt = [&]() -> std::int32_t {
+        std::int32_t value = 0;
+        if (end - pos < static_cast<std::ptrdiff_t>(sizeof(value)))
         {
-            continue;
+            isValid = false;
+            return value;
         }
 
-        const std::string name = cardData["name"].is_null()
-                                     ? ""
-                                     : cardData["name"].get<std::string>();
-        const int dbfID =
-            cardData["dbfId"].is_null() ? 0 : cardData["dbfId"].get<int>();
-        const std::string text = cardData["text"].is_null()
-                                     ? ""
-                                     : cardData["text"].get<std::string>();
-
-        const int attack =
-            cardData["attack"].is_null() ? 0 : cardData["attack"].get<int>();
-        const int cardRace = cardData["race"].is_null()
-                                 ? 0
-                                 : static_cast<int>(StrToEnum<Race>(
-                                       cardData["race"].get<std::string>()));
-        const int cardSet = cardData["set"].is_null()
-                                ? 1
-                                : static_cast<int>(StrToEnum<CardSet>(
-                                      cardData["set"].get<std::string>()));
-        const int cardType = cardData["type"].is_null()
-                                 ? 0
-                                 : static_cast<int>(StrToEnum<CardType>(
-                                       cardData["type"].get<std::string>()));
-        const int cardClass =
-            cardData["cardClass"].is_null()
-                ? 0
-                : static_cast<int>(StrToEnum<CardClass>(
-                      cardData["cardClass"].get<std::string>()));
-        const int collectible = cardData["collectible"].is_null()
-                                    ? 0
-                                    : cardData["collectible"].get<int>();
-        const int cost =
-            cardData["cost"].is_null() ? 0 : cardData["cost"].get<int>();
-        const int durability = cardData["durability"].is_null()
-                                   ? 0
-                                   : cardData["durability"].get<int>();
-        const int faction = cardData["faction"].is_null()
-                                ? 0
-                                : static_cast<int>(StrToEnum<Faction>(
-                                      cardData["faction"].get<std::string>()));
-        const int health =
-            cardData["health"].is_null() ? 0 : cardData["health"].get<int>();
-        const int rarity = cardData["rarity"].is_null()
-                               ? 0
-                               : static_cast<int>(StrToEnum<Rarity>(
-                                     cardData["rarity"].get<std::string>()));
-        const int spellPower = cardData["spellDamage"].is_null()
-                                   ? 0
-                                   : cardData["spellDamage"].get<int>();
-        const int overload = cardData["overload"].is_null()
-                                 ? 0
-                                 : cardData["overload"].get<int>();
-
-        std::map<GameTag, int> gameTags;
-        for (auto& mechanic : cardData["mechanics"])
+        std::memcpy(&value, pos, sizeof(value));
+        pos += sizeof(value);
+        return value;
+    };
+
+    const auto readInt64 = [&]() -> std::int64_t {
+        std::int64_t value = 0;
+        if (end - pos < static_cast<std::ptrdiff_t>(sizeof(value)))
         {
-            gameTags.emplace(StrToEnum<GameTag>(mechanic.get<std::string>()),
-                             1);
+            isValid = false;
+            return value;
         }
 
-        // NOTE: Erase invalid mechanics 'FREEZE' of Frost Elemental (EX1_283)
-        if (name == "Frost Elemental")
+        std::memcpy(&value, pos, sizeof(value));
+        pos += sizeof(value);
+        return value;
+    };
+
+    const auto readString = [&]() -> std::string {
+        const std::int32_t length = readInt();
+        if (length < 0 || end - pos < length)
         {
-            gameTags[GameTag::FREEZE] = 0;
+            isValid = false;
+            return std::string();
         }
 
-        std::map<PlayReq, int> playRequirements;
-        for (auto iter = cardData["playRequirements"].begin();
-             iter != cardData["playRequirements"].end(); ++iter)
+        std::string value(pos, static_cast<std::size_t>(length));
+        pos += length;
+        return value;
+    };
+
+    // Check the header
+    if (size < sizeof(CARD_DATA_MAGIC) ||
+        std::memcmp(pos, CARD_DATA_MAGIC, sizeof(CARD_DATA_MAGIC)) != 0)
+    {
+        isValid = false;
+    }
+    else
+    {
+        pos += sizeof(CARD_DATA_MAGIC);
+        isValid = readInt() == CARD_DATA_VERSION &&
+                  readInt() == CARD_DATA_NUM_GAME_TAGS &&
+                  readInt() == CARD_DATA_NUM_PLAY_REQS;
+
+        const std::int64_t size = readInt64();
+        const std::int64_t modifiedTime = readInt64();
+        if (hasJson && (size != jsonSize || modifiedTime != jsonModifiedTime))
         {
-            playRequirements.try_emplace(StrToEnum<PlayReq>(iter.key()),
-                                         iter.value().get<int>());
+            isValid = false;
         }
+    }
 
-        std::vector<std::string> entourages;
-        for (auto& entourage : cardData["entourage"])
+    std::vector<Card*> loadedCards;
+    const std::int32_t numCards = isValid ? readInt() : 0;
+    if (numCards < 0 || numCards > (end - pos) / CARD_DATA_MIN_CARD_SIZE)
+    {
+        isValid = false;
+    }
+    loadedCards.reserve(isValid ? numCards : 0);
+
+    for (std::int32_t i = 0; isValid && i < numCards; ++i)
+    {
+        Card* card = new Card();
+        loadedCards.emplace_back(card);
+
+        card->id = readString();
+        card->dbfID = readInt();
+        card->name = readString();
+        card->text = readString();
+
+        const std::int32_t numGameTags = readInt();
+        for (std::int32_t j = 0; isValid && j < numGameTags; ++j)
+        {
+            const std::int32_t gameTag = readInt();
+            if (gameTag < 0 || gameTag >= CARD_DATA_NUM_GAME_TAGS)
+            {
+                isValid = false;
+                break;
+            }
+
+            card->gameTags.emplace_hint(card->gameTags.end(),
+                                        static_cast<GameTag>(gameTag),
+                                        readInt());
+        }
+
+        const std::int32_t numPlayReqs = readInt();
+        for (std::int32_t j = 0; isValid && j < numPlayReqs; ++j)
         {
-            entourages.emplace_back(entourage.get<std::string>());
+            const std::int32_t playReq = readInt();
+            if (playReq < 0 || playReq >= CARD_DATA_NUM_PLAY_REQS)
+            {
+                isValid = false;
+                break;
+            }
+
+            card->playRequirements.emplace_hint(card->playRequirements.end(),
+                                                static_cast<PlayReq>(playReq),
+                                                readInt());
         }
 
-        Card* card = new Card();
-        card->id = id;
-        card->dbfID = dbfID;
-        card->name = name;
-        card->text = text;
-
-        card->gameTags = gameTags;
-        card->playRequirements = playRequirements;
-        card->entourages = entourages;
-
-        card->gameTags[GameTag::ATK] = attack;
-        card->gameTags[GameTag::CARDRACE] = cardRace;
-        card->gameTags[GameTag::CARD_SET] = cardSet;
-        card->gameTags[GameTag::CARDTYPE] = cardType;
-        card->gameTags[GameTag::CLASS] = cardClass;
-        card->gameTags[GameTag::COLLECTIBLE] = collectible;
-        card->gameTags[GameTag::COST] = cost;
-        card->gameTags[GameTag::DAMAGE] = 0;
-        card->gameTags[GameTag::DURABILITY] = durability;
-        card->gameTags[GameTag::FACTION] = faction;
-        card->gameTags[GameTag::HEALTH] = health;
-        card->gameTags[GameTag::RARITY] = rarity;
-        card->gameTags[GameTag::SPELLPOWER] = spellPower;
-        card->gameTags[GameTag::OVERLOAD] = overload;
-
-        card->Initialize();
-
-        cards.emplace_back(card);
+        const std::int32_t numEntourages = readInt();
+        for (std::int32_t j = 0; isValid && j < numEntourages; ++j)
+        {
+            card->entourages.emplace_back(readString());
+        }
+
+        if (isValid)
+        {
+            card->Initialize();
+        }
+    }
+
+#if !defined(ROSETTASTONE_WINDOWS)
+    munmap(mapped, size);
+#endif
+
+    if (!isValid || pos != end)
+    {
+        for (Card* card : loadedCards)
+        {
+            delete card;
+        }
+
+        return false;
+    }
+
+    cards.insert(cards.end(), loadedCards.begin(), loadedCards.end());
+
+    return true;
+}
+
+void CardLoader::SaveToBinary(const std::string& path,
+                              const std::string& jsonPath,
+                              const std::vector<Card*>& cards)
+{
+    std::int64_t jsonSize = 0;
+    std::int64_t jsonModifiedTime = 0;
+    if (!ReadStamp(jsonPath, jsonSize, jsonModifiedTime))
+    {
+        throw std::runtime_error("Can't open " + jsonPath);
+    }
+
+    const std::string tempPath = path + ".tmp";
+    std::ofstream cardFile(tempPath, std::ios::binary | std::ios::trunc);
+    if (!cardFile.is_open())
+    {
+        throw std::runtime_error("Can't open " + tempPath);
+    }
+
+    const auto writeInt = [&cardFile](std::int32_t value) {
+        cardFile.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    const auto writeInt64 = [&cardFile](std::int64_t value) {
+        cardFile.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    const auto writeString = [&cardFile, &writeInt](const std::string& value) {
+        writeInt(static_cast<std::int32_t>(value.size()));
+        cardFile.write(value.data(), value.size());
+    };
+
+    cardFile.write(CARD_DATA_MAGIC, sizeof(CARD_DATA_MAGIC));
+    writeInt(CARD_DATA_VERSION);
+    writeInt(CARD_DATA_NUM_GAME_TAGS);
+    writeInt(CARD_DATA_NUM_PLAY_REQS);
+    writeInt64(jsonSize);
+    writeInt64(jsonModifiedTime);
+    writeInt(static_cast<std::int32_t>(cards.size()));
+
+    for (const Card* card : cards)
+    {
+        writeString(card->id);
+        writeInt(card->dbfID);
+        writeString(card->name);
+        writeString(card->text);
+
+        writeInt(static_cast<std::int32_t>(card->gameTags.size()));
+        for (auto& [gameTag, value] : card->gameTags)
+        {
+            writeInt(static_cast<std::int32_t>(gameTag));
+            writeInt(value);
+        }
+
+        writeInt(static_cast<std::int32_t>(card->playRequirements.size()));
+        for (auto& [playReq, value] : card->playRequirements)
+        {
+            writeInt(static_cast<std::int32_t>(playReq));
+            writeInt(value);
+        }
+
+        writeInt(static_cast<std::int32_t>(card->entourages.size()));
+        for (auto& entourage : card->entourages)
+        {
+            writeString(entourage);
+        }
     }
 
     cardFile.close();
+    if (!cardFile)
+    {
+        std::remove(tempPath.c_str());
+        throw std::runtime_error("Can't write " + tempPath);
+    }
+
+    // Replace the binary file at once
+#if defined(ROSETTASTONE_WINDOWS)
+    std::remove(path.c_str());
+#endif
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tempPath.c_str());
+        throw std::runtime_error("Can't write " + path);
+    }
+}
+
+bool CardLoader::ReadStamp(const std::string& path, std::int64_t& size,
+                           std::int64_t& modifiedTime)
+{
+    struct stat fileStat;
+    if (stat(path.c_str(), &fileStat) != 0)
+    {
+        return false;
+    }
+
+    size = static_cast<std::int64_t>(fileStat.st_size);
+    modifiedTime = static_cast<std::int64_t>(fileStat.st_mtime);
+
+    return true;
 }
 }  // namespace RosettaStone
@@ -18,6 +18,12 @@ Character::Character(Player& _owner, Card* _card, std::map<GameTag, int> tags)
     // Do nothing
 }
 
+Character::Character(const Character& prototype, Player& _owner)
+    : Entity(prototype, _owner)
+{
+    // Do nothing
+}
+
 int Character::GetAttack() const
 {
     return GetGameTag(GameTag::ATK);
@@ -137,7 +143,7 @@ std::vector<Character*> Character::GetValidCombatTargets(Player& opponent) const
     std::vector<Character*> targets;
     std::vector<Character*> targetsHaveTaunt;
 
-    for (auto& minion : opponent.GetFieldZone().GetAll())
+    for (auto& minion : opponent.GetFieldZone().GetAlive())
     {
         if (minion->GetGameTag(GameTag::STEALTH) == 0)
         {
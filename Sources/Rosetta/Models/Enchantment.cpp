@@ -20,6 +20,17 @@ Enchantment::Enchantment(Player& _owner, Card* _card,
     // Do nothing
 }
 
+Enchantment::Enchantment(const Enchantment& prototype, Player& _owner)
+    : Entity(prototype, _owner)
+{
+    // Do nothing
+}
+
+Entity* Enchantment::Clone(Player& _owner) const
+{
+    return new (_owner.GetArena()) Enchantment(*this, _owner);
+}
+
 Enchantment* Enchantment::GetInstance(Player& player, Card* card,
                                       Entity* target)
 {
@@ -28,7 +39,8 @@ Enchantment* Enchantment::GetInstance(Player& player, Card* card,
     tags[GameTag::CONTROLLER] = player.playerID;
     tags[GameTag::ZONE] = static_cast<int>(ZoneType::SETASIDE);
 
-    Enchantment* instance = new Enchantment(player, card, tags, target);
+    Enchantment* instance =
+        new (player.GetArena()) Enchantment(player, card, tags, target);
 
     target->appliedEnchantments.emplace_back(instance);
 
@@ -40,6 +52,11 @@ Entity* Enchantment::GetTarget() const
     return m_target;
 }
 
+void Enchantment::SetTarget(Entity* target)
+{
+    m_target = target;
+}
+
 void Enchantment::Remove()
 {
     if (!card->power.GetDeathrattleTask().empty())
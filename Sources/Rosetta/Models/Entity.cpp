@@ -19,11 +19,24 @@ Entity::Entity(Player& _owner, Card* _card, std::map<GameTag, int> tags)
 {
     for (auto& gameTag : _card->gameTags)
     {
-        Entity::SetGameTag(gameTag.first, gameTag.second);
+        m_gameTags.Set(gameTag.first, gameTag.second);
     }
 
     id = tags[GameTag::ENTITY_ID];
-    auraEffects = new AuraEffects(this);
+    auraEffects = new (_owner.GetArena()) AuraEffects(this);
+}
+
+Entity::Entity(const Entity& prototype, Player& _owner)
+    : owner(&_owner),
+      card(prototype.card),
+      id(prototype.id),
+      orderOfPlay(prototype.orderOfPlay),
+      isDestroyed(prototype.isDestroyed),
+      hashEntry(prototype.hashEntry),
+      m_gameTags(prototype.m_gameTags)
+{
+    auraEffects = new (_owner.GetArena())
+        AuraEffects(*prototype.auraEffects, this);
 }
 
 Entity::~Entity()
@@ -31,51 +44,57 @@ Entity::~Entity()
     delete auraEffects;
     delete onGoingEffect;
 
-    m_gameTags.clear();
+    m_gameTags.Clear();
 }
 
 std::map<GameTag, int> Entity::GetGameTags() const
 {
-    return m_gameTags;
+    return m_gameTags.ToMap();
 }
 
 int Entity::GetGameTag(GameTag tag) const
 {
     int value = 0;
 
-    const auto entityVal = m_gameTags.find(tag);
-    if (entityVal == m_gameTags.end())
+    if (const int* entityVal = m_gameTags.Find(tag); entityVal != nullptr)
     {
-        if (card != nullptr)
-        {
-            const auto cardVal = card->gameTags.find(tag);
-            if (cardVal != card->gameTags.end())
-            {
-                value = cardVal->second;
-            }
-        }
-
-        if (auraEffects != nullptr)
-        {
-            value += auraEffects->GetGameTag(tag);
-        }
+        value = *entityVal;
     }
-    else
+    else if (card != nullptr)
     {
-        value += entityVal->second;
-
-        if (auraEffects != nullptr)
+        const auto cardVal = card->gameTags.find(tag);
+        if (cardVal != card->gameTags.end())
         {
-            value += auraEffects->GetGameTag(tag);
+            value = cardVal->second;
         }
     }
 
+    if (auraEffects != nullptr)
+    {
+        value += auraEffects->GetGameTag(tag);
+    }
+
     return value > 0 ? value : 0;
 }
 
 void Entity::SetGameTag(GameTag tag, int value)
 {
-    m_gameTags.insert_or_assign(tag, value);
+    // Moving to another zone changes the part of the hash the entity is in
+    if (hashEntry.scope == HashScope::NONE && tag != GameTag::ZONE)
+    {
+        m_gameTags.Set(tag, value);
+        return;
+    }
+
+    ZobristHash& hash = owner->GetGame()->zobristHash;
+    hash.RemoveEntity(*this);
+    m_gameTags.Set(tag, value);
+    hash.AddEntity(*this);
+}
+
+std::uint64_t Entity::GetGameTagHash() const
+{
+    return m_gameTags.GetHash();
 }
 
 ZoneType Entity::GetZoneType() const
@@ -159,18 +178,29 @@ bool Entity::HasChooseOne() const
 
 void Entity::Reset()
 {
-    m_gameTags.erase(GameTag::DAMAGE);
-    m_gameTags.erase(GameTag::EXHAUSTED);
-    m_gameTags.erase(GameTag::ATK);
-    m_gameTags.erase(GameTag::HEALTH);
-    m_gameTags.erase(GameTag::COST);
-    m_gameTags.erase(GameTag::TAUNT);
-    m_gameTags.erase(GameTag::FROZEN);
-    m_gameTags.erase(GameTag::CHARGE);
-    m_gameTags.erase(GameTag::WINDFURY);
-    m_gameTags.erase(GameTag::DIVINE_SHIELD);
-    m_gameTags.erase(GameTag::STEALTH);
-    m_gameTags.erase(GameTag::NUM_ATTACKS_THIS_TURN);
+    const bool isHashed = hashEntry.scope != HashScope::NONE;
+    if (isHashed)
+    {
+        owner->GetGame()->zobristHash.RemoveEntity(*this);
+    }
+
+    m_gameTags.Erase(GameTag::DAMAGE);
+    m_gameTags.Erase(GameTag::EXHAUSTED);
+    m_gameTags.Erase(GameTag::ATK);
+    m_gameTags.Erase(GameTag::HEALTH);
+    m_gameTags.Erase(GameTag::COST);
+    m_gameTags.Erase(GameTag::TAUNT);
+    m_gameTags.Erase(GameTag::FROZEN);
+    m_gameTags.Erase(GameTag::CHARGE);
+    m_gameTags.Erase(GameTag::WINDFURY);
+    m_gameTags.Erase(GameTag::DIVINE_SHIELD);
+    m_gameTags.Erase(GameTag::STEALTH);
+    m_gameTags.Erase(GameTag::NUM_ATTACKS_THIS_TURN);
+
+    if (isHashed)
+    {
+        owner->GetGame()->zobristHash.AddEntity(*this);
+    }
 }
 
 void Entity::Destroy()
@@ -212,7 +242,7 @@ void Entity::ActivateTask(PowerType type, Entity* target, int chooseOne,
 
     for (auto& task : tasks)
     {
-        ITask* clonedTask = task->Clone();
+        ITask* clonedTask = task->Clone(owner->GetArena());
 
         clonedTask->SetPlayer(owner);
         clonedTask->SetSource(chooseBase == nullptr ? this : chooseBase);
@@ -222,6 +252,11 @@ void Entity::ActivateTask(PowerType type, Entity* target, int chooseOne,
     }
 }
 
+Entity* Entity::Clone(Player& _owner) const
+{
+    return new (_owner.GetArena()) Entity(*this, _owner);
+}
+
 Entity* Entity::GetFromCard(Player& player, Card* card,
                             std::optional<std::map<GameTag, int>> cardTags,
                             IZone* zone, int id)
@@ -242,20 +277,20 @@ Entity* Entity::GetFromCard(Player& player, Card* card,
     switch (card->GetCardType())
     {
         case CardType::HERO:
-            result = new Hero(player, card, tags);
+            result = new (player.GetArena()) Hero(player, card, tags);
             break;
         case CardType::HERO_POWER:
             tags[GameTag::ZONE] = static_cast<int>(ZoneType::PLAY);
-            result = new HeroPower(player, card, tags);
+            result = new (player.GetArena()) HeroPower(player, card, tags);
             break;
         case CardType::MINION:
-            result = new Minion(player, card, tags);
+            result = new (player.GetArena()) Minion(player, card, tags);
             break;
         case CardType::SPELL:
-            result = new Spell(player, card, tags);
+            result = new (player.GetArena()) Spell(player, card, tags);
             break;
         case CardType::WEAPON:
-            result = new Weapon(player, card, tags);
+            result = new (player.GetArena()) Weapon(player, card, tags);
             break;
         default:
             throw std::invalid_argument(
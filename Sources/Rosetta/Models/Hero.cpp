@@ -18,6 +18,17 @@ Hero::Hero(Player& _owner, Card* _card, std::map<GameTag, int> tags)
     // Do nothing
 }
 
+Hero::Hero(const Hero& prototype, Player& _owner)
+    : Character(prototype, _owner), fatigue(prototype.fatigue)
+{
+    // Do nothing
+}
+
+Entity* Hero::Clone(Player& _owner) const
+{
+    return new (_owner.GetArena()) Hero(*this, _owner);
+}
+
 Hero::~Hero()
 {
     delete weapon;
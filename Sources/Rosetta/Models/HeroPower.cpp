@@ -5,6 +5,7 @@
 // property of any third parties.
 
 #include <Rosetta/Models/HeroPower.hpp>
+#include <Rosetta/Models/Player.hpp>
 
 #include <utility>
 
@@ -15,4 +16,15 @@ HeroPower::HeroPower(Player& _owner, Card* _card, std::map<GameTag, int> tags)
 {
     // Do nothing
 }
+
+HeroPower::HeroPower(const HeroPower& prototype, Player& _owner)
+    : Entity(prototype, _owner)
+{
+    // Do nothing
+}
+
+Entity* HeroPower::Clone(Player& _owner) const
+{
+    return new (_owner.GetArena()) HeroPower(*this, _owner);
+}
 }  // namespace RosettaStone
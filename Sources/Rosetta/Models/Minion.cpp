@@ -20,6 +20,17 @@ Minion::Minion(Player& _owner, Card* _card, std::map<GameTag, int> tags)
     // Do nothing
 }
 
+Minion::Minion(const Minion& prototype, Player& _owner)
+    : Character(prototype, _owner)
+{
+    // Do nothing
+}
+
+Entity* Minion::Clone(Player& _owner) const
+{
+    return new (_owner.GetArena()) Minion(*this, _owner);
+}
+
 int Minion::GetLastBoardPos() const
 {
     return GetGameTag(GameTag::TAG_LAST_KNOWN_COST_IN_HAND);
@@ -5,6 +5,7 @@
 // property of any third parties.
 
 #include <Rosetta/Commons/Utils.hpp>
+#include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Models/HeroPower.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Policies/Policy.hpp>
@@ -64,6 +65,43 @@ void Player::RefCopy(const Player& rhs)
     m_gameTags = rhs.m_gameTags;
 }
 
+void Player::CopyFrom(
+    const Player& rhs,
+    const std::function<Entity*(const Entity*)>& cloneEntity)
+{
+    nickname = rhs.nickname;
+    playerType = rhs.playerType;
+    playerID = rhs.playerID;
+
+    playState = rhs.playState;
+    mulliganState = rhs.mulliganState;
+    choice = rhs.choice;
+
+    policy = rhs.policy;
+
+    currentSpellPower = rhs.currentSpellPower;
+
+    m_hero = static_cast<Hero*>(cloneEntity(rhs.m_hero));
+
+    const auto copyZone = [&cloneEntity](auto& zone, auto& rhsZone) {
+        for (int i = 0; i < rhsZone.GetCount(); ++i)
+        {
+            const auto entity = rhsZone[i];
+            zone.MoveTo(*static_cast<decltype(entity)>(cloneEntity(entity)),
+                        i);
+        }
+    };
+
+    copyZone(*m_deckZone, *rhs.m_deckZone);
+    copyZone(*m_fieldZone, *rhs.m_fieldZone);
+    copyZone(*m_graveyardZone, *rhs.m_graveyardZone);
+    copyZone(*m_handZone, *rhs.m_handZone);
+    copyZone(*m_secretZone, *rhs.m_secretZone);
+    copyZone(*m_setasideZone, *rhs.m_setasideZone);
+
+    m_gameTags = rhs.m_gameTags;
+}
+
 Game* Player::GetGame() const
 {
     return m_game;
@@ -74,6 +112,11 @@ void Player::SetGame(Game* game)
     m_game = game;
 }
 
+Arena* Player::GetArena() const
+{
+    return m_game != nullptr ? &m_game->GetArena() : nullptr;
+}
+
 FieldZone& Player::GetFieldZone() const
 {
     return *m_fieldZone;
@@ -111,17 +154,19 @@ Hero* Player::GetHero() const
 
 int Player::GetGameTag(GameTag tag) const
 {
-    if (m_gameTags.find(tag) == m_gameTags.end())
-    {
-        return 0;
-    }
-
-    return m_gameTags.at(tag);
+    return m_gameTags.Get(tag);
 }
 
 void Player::SetGameTag(GameTag tag, int value)
 {
-    m_gameTags.insert_or_assign(tag, value);
+    const std::uint64_t prevTagHash = m_gameTags.GetHash();
+    m_gameTags.Set(tag, value);
+
+    if (m_game != nullptr)
+    {
+        m_game->zobristHash.UpdatePlayer(playerType, prevTagHash,
+                                         m_gameTags.GetHash());
+    }
 }
 
 int Player::GetTotalMana() const
@@ -224,6 +269,9 @@ void Player::AddHeroAndPower(Card* heroCard, Card* powerCard)
         dynamic_cast<Hero*>(Entity::GetFromCard(*this, heroCard));
     m_hero->heroPower = dynamic_cast<HeroPower*>(
         Entity::GetFromCard(*this, powerCard));
+
+    m_hero->SetZoneType(ZoneType::PLAY);
+    m_hero->heroPower->SetZoneType(ZoneType::PLAY);
 }
 
 ITask* Player::GetTaskByAction(TaskMeta& next, TaskMeta& req)
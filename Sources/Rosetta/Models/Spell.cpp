@@ -4,6 +4,7 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Models/Spell.hpp>
 
 #include <utility>
@@ -16,6 +17,17 @@ Spell::Spell(Player& _owner, Card* _card, std::map<GameTag, int> tags)
     // Do nothing
 }
 
+Spell::Spell(const Spell& prototype, Player& _owner)
+    : Entity(prototype, _owner)
+{
+    // Do nothing
+}
+
+Entity* Spell::Clone(Player& _owner) const
+{
+    return new (_owner.GetArena()) Spell(*this, _owner);
+}
+
 bool Spell::IsSecret() const
 {
     return GetGameTag(GameTag::SECRET) == 1;
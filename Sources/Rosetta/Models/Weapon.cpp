@@ -17,6 +17,17 @@ Weapon::Weapon(Player& _owner, Card* _card, std::map<GameTag, int> tags)
     // Do nothing
 }
 
+Weapon::Weapon(const Weapon& prototype, Player& _owner)
+    : Entity(prototype, _owner)
+{
+    // Do nothing
+}
+
+Entity* Weapon::Clone(Player& _owner) const
+{
+    return new (_owner.GetArena()) Weapon(*this, _owner);
+}
+
 Weapon::~Weapon()
 {
     owner->GetHero()->weapon = nullptr;
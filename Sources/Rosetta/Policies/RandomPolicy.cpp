@@ -9,14 +9,10 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Policies/RandomPolicy.hpp>
 
-#include <effolkronium/random.hpp>
-
 namespace RosettaStone
 {
 TaskMeta RandomPolicy::Next(const Game& game)
 {
-    using Random = effolkronium::random_static;
-
     std::vector<TaskID> list = { TaskID::END_TURN };
 
     Player& player = game.GetCurrentPlayer();
@@ -30,17 +26,17 @@ TaskMeta RandomPolicy::Next(const Game& game)
         list.push_back(TaskID::ATTACK);
     }
 
-    return TaskMeta(TaskMetaTrait(*Random::get(list)));
+    return TaskMeta(TaskMetaTrait(*player.GetGame()->random.Get(list)));
 }
 
 TaskMeta RandomPolicy::RequireMulligan(Player& player)
 {
-    using Random = effolkronium::random_static;
+    Random& random = player.GetGame()->random;
 
     std::vector<std::size_t> selected;
     for (std::size_t id : player.choice.value().choices)
     {
-        if (Random::get(0, 1) == 0)
+        if (random.Get(0, 1) == 0)
         {
             selected.push_back(id);
         }
@@ -51,11 +47,11 @@ TaskMeta RandomPolicy::RequireMulligan(Player& player)
 
 TaskMeta RandomPolicy::RequirePlayCard(Player& player)
 {
-    using Random = effolkronium::random_static;
+    Random& random = player.GetGame()->random;
 
     std::vector<std::tuple<Entity*, Entity*>> possible;
 
-    for (Entity* entity : player.GetHandZone().GetAll())
+    for (Entity* entity : player.GetHandZone().GetAlive())
     {
         if (entity->GetCost() > player.GetRemainingMana())
         {
@@ -76,7 +72,7 @@ TaskMeta RandomPolicy::RequirePlayCard(Player& player)
                 continue;
             }
 
-            auto target = *Random::get(targets);
+            auto target = *random.Get(targets);
             possible.emplace_back(std::make_tuple(entity, target));
         }
         else
@@ -90,7 +86,7 @@ TaskMeta RandomPolicy::RequirePlayCard(Player& player)
         return TaskMeta(TaskMetaTrait(TaskID::PLAY_CARD), SizedPtr<Entity*>());
     }
 
-    auto [source, target] = *Random::get(possible);
+    auto [source, target] = *random.Get(possible);
     SizedPtr<Entity*> ptr;
 
     if (target != nullptr)
@@ -110,12 +106,11 @@ TaskMeta RandomPolicy::RequirePlayCard(Player& player)
 
 TaskMeta RandomPolicy::RequireAttack(Player& player)
 {
-    using Random = effolkronium::random_static;
-
+    Random& random = player.GetGame()->random;
     Player& other = *player.opponent;
 
     std::vector<Character*> sources;
-    for (auto* minion : player.GetFieldZone().GetAll())
+    for (auto* minion : player.GetFieldZone().GetAlive())
     {
         sources.emplace_back(minion);
     }
@@ -135,7 +130,7 @@ TaskMeta RandomPolicy::RequireAttack(Player& player)
             possible.emplace_back(std::make_tuple(source, hero));
         }
 
-        for (Character* target : other.GetFieldZone().GetAll())
+        for (Character* target : other.GetFieldZone().GetAlive())
         {
             if (source->IsValidCombatTarget(other, target))
             {
@@ -150,7 +145,7 @@ TaskMeta RandomPolicy::RequireAttack(Player& player)
     }
     else
     {
-        auto [source, target] = *Random::get(possible);
+        auto [source, target] = *random.Get(possible);
 
         SizedPtr<Entity*> ptr(2);
         ptr[0] = source;
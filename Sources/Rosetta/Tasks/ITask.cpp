@@ -30,16 +30,31 @@ EntityType ITask::GetEntityType() const
     return m_entityType;
 }
 
+Player* ITask::GetPlayer() const
+{
+    return m_player;
+}
+
 void ITask::SetPlayer(Player* player)
 {
     m_player = player;
 }
 
+Entity* ITask::GetSource() const
+{
+    return m_source;
+}
+
 void ITask::SetSource(Entity* source)
 {
     m_source = source;
 }
 
+Entity* ITask::GetTarget() const
+{
+    return m_target;
+}
+
 void ITask::SetTarget(Entity* target)
 {
     m_target = target;
@@ -50,9 +65,9 @@ TaskStatus ITask::Run()
     return Impl(*m_player);
 }
 
-ITask* ITask::Clone()
+ITask* ITask::Clone(Arena* arena)
 {
-    ITask* clonedTask = CloneImpl();
+    ITask* clonedTask = CloneImpl(arena);
     clonedTask->EnableFreeable();
 
     clonedTask->m_entityType = m_entityType;
@@ -26,8 +26,8 @@ TaskStatus AttackTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* AttackTask::CloneImpl()
+ITask* AttackTask::CloneImpl(Arena* arena)
 {
-    return new AttackTask(m_source, m_target);
+    return new (arena) AttackTask(m_source, m_target);
 }
 }  // namespace RosettaStone::PlayerTasks
@@ -60,8 +60,8 @@ TaskStatus ChooseTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* ChooseTask::CloneImpl()
+ITask* ChooseTask::CloneImpl(Arena* arena)
 {
-    return new ChooseTask(m_choices);
+    return new (arena) ChooseTask(m_choices);
 }
 }  // namespace RosettaStone::PlayerTasks
@@ -4,7 +4,6 @@
 // Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
 
 #include <Rosetta/Games/Game.hpp>
-#include <Rosetta/Games/GameManager.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Tasks/PlayerTasks/EndTurnTask.hpp>
 
@@ -19,14 +18,14 @@ TaskStatus EndTurnTask::Impl(Player& player)
 {
     auto game = player.GetGame();
 
+    // Game::Process() runs the steps to end the turn after the task
     game->nextStep = Step::MAIN_END;
-    GameManager::ProcessNextStep(*game, game->nextStep);
 
     return TaskStatus::COMPLETE;
 }
 
-ITask* EndTurnTask::CloneImpl()
+ITask* EndTurnTask::CloneImpl(Arena* arena)
 {
-    return new EndTurnTask();
+    return new (arena) EndTurnTask();
 }
 }  // namespace RosettaStone::PlayerTasks
@@ -68,8 +68,8 @@ TaskStatus HeroPowerTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* HeroPowerTask::CloneImpl()
+ITask* HeroPowerTask::CloneImpl(Arena* arena)
 {
-    return new HeroPowerTask(m_target);
+    return new (arena) HeroPowerTask(m_target);
 }
 }  // namespace RosettaStone::PlayerTasks
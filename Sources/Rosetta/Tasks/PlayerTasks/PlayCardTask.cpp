@@ -60,8 +60,9 @@ TaskStatus PlayCardTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* PlayCardTask::CloneImpl()
+ITask* PlayCardTask::CloneImpl(Arena* arena)
 {
-    return new PlayCardTask(m_source, m_target, m_fieldPos, m_chooseOne);
+    return new (arena)
+        PlayCardTask(m_source, m_target, m_fieldPos, m_chooseOne);
 }
 }  // namespace RosettaStone::PlayerTasks
@@ -31,8 +31,8 @@ TaskStatus AddAuraEffectTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* AddAuraEffectTask::CloneImpl()
+ITask* AddAuraEffectTask::CloneImpl(Arena* arena)
 {
-    return new AddAuraEffectTask(m_effect, m_entityType);
+    return new (arena) AddAuraEffectTask(m_effect, m_entityType);
 }
 }  // namespace RosettaStone::SimpleTasks
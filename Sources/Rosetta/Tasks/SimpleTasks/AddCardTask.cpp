@@ -55,8 +55,8 @@ TaskStatus AddCardTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* AddCardTask::CloneImpl()
+ITask* AddCardTask::CloneImpl(Arena* arena)
 {
-    return new AddCardTask(m_entityType, m_cardID, m_amount);
+    return new (arena) AddCardTask(m_entityType, m_cardID, m_amount);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -66,8 +66,8 @@ TaskStatus AddEnchantmentTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* AddEnchantmentTask::CloneImpl()
+ITask* AddEnchantmentTask::CloneImpl(Arena* arena)
 {
-    return new AddEnchantmentTask(m_cardID, m_entityType);
+    return new (arena) AddEnchantmentTask(m_cardID, m_entityType);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -39,8 +39,8 @@ TaskStatus AddStackToTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* AddStackToTask::CloneImpl()
+ITask* AddStackToTask::CloneImpl(Arena* arena)
 {
-    return new AddStackToTask(m_entityType);
+    return new (arena) AddStackToTask(m_entityType);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -24,8 +24,8 @@ TaskStatus ArmorTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* ArmorTask::CloneImpl()
+ITask* ArmorTask::CloneImpl(Arena* arena)
 {
-    return new ArmorTask(m_amount);
+    return new (arena) ArmorTask(m_amount);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -6,10 +6,6 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/ChanceTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 ChanceTask::ChanceTask(bool useFlag) : m_useFlag(useFlag)
@@ -24,7 +20,7 @@ TaskID ChanceTask::GetTaskID() const
 
 TaskStatus ChanceTask::Impl(Player& player)
 {
-    const auto num = Random::get<int>(0, 1);
+    const auto num = player.GetGame()->random.Get(0, 1);
 
     if (!m_useFlag)
     {
@@ -35,8 +31,8 @@ TaskStatus ChanceTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* ChanceTask::CloneImpl()
+ITask* ChanceTask::CloneImpl(Arena* arena)
 {
-    return new ChanceTask(m_useFlag);
+    return new (arena) ChanceTask(m_useFlag);
 }
 }  // namespace RosettaStone::SimpleTasks
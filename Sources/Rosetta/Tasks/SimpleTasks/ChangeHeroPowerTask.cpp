@@ -21,15 +21,17 @@ TaskID ChangeHeroPowerTask::GetTaskID() const
 
 TaskStatus ChangeHeroPowerTask::Impl(Player& player)
 {
+    ZobristHash::Detach(*player.GetHero()->heroPower);
     delete player.GetHero()->heroPower;
     player.GetHero()->heroPower =
         dynamic_cast<HeroPower*>(Entity::GetFromCard(player, m_card));
+    player.GetHero()->heroPower->SetZoneType(ZoneType::PLAY);
 
     return TaskStatus::COMPLETE;
 }
 
-ITask* ChangeHeroPowerTask::CloneImpl()
+ITask* ChangeHeroPowerTask::CloneImpl(Arena* arena)
 {
-    return new ChangeHeroPowerTask(m_card->id);
+    return new (arena) ChangeHeroPowerTask(m_card->id);
 }
 }  // namespace RosettaStone::SimpleTasks
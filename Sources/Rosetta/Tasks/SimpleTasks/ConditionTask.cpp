@@ -71,8 +71,9 @@ TaskStatus ConditionTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* ConditionTask::CloneImpl()
+ITask* ConditionTask::CloneImpl(Arena* arena)
 {
-    return new ConditionTask(m_entityType, m_selfConditions, m_relaConditions);
+    return new (arena)
+        ConditionTask(m_entityType, m_selfConditions, m_relaConditions);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -47,8 +47,8 @@ TaskStatus ControlTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* ControlTask::CloneImpl()
+ITask* ControlTask::CloneImpl(Arena* arena)
 {
-    return new ControlTask(m_entityType);
+    return new (arena) ControlTask(m_entityType);
 }
 }  // namespace RosettaStone::SimpleTasks
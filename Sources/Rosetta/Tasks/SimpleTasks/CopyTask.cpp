@@ -130,9 +130,9 @@ TaskStatus CopyTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* CopyTask::CloneImpl()
+ITask* CopyTask::CloneImpl(Arena* arena)
 {
-    return new CopyTask(m_entityType, m_zoneType, m_amount, m_addToStack,
-                        m_toOpponent);
+    return new (arena) CopyTask(m_entityType, m_zoneType, m_amount,
+                                m_addToStack, m_toOpponent);
 }
 }  // namespace RosettaStone::SimpleTasks
\ No newline at end of file
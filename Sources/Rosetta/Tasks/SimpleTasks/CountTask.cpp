@@ -69,8 +69,8 @@ TaskStatus CountTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* CountTask::CloneImpl()
+ITask* CountTask::CloneImpl(Arena* arena)
 {
-    return new CountTask(m_entityType, m_numIndex, m_conditions);
+    return new (arena) CountTask(m_entityType, m_numIndex, m_conditions);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -37,8 +37,8 @@ TaskStatus DamageNumberTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* DamageNumberTask::CloneImpl()
+ITask* DamageNumberTask::CloneImpl(Arena* arena)
 {
-    return new DamageNumberTask(m_entityType, m_isSpellDamage);
+    return new (arena) DamageNumberTask(m_entityType, m_isSpellDamage);
 }
 }  // namespace RosettaStone::SimpleTasks
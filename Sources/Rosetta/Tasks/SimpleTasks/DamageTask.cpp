@@ -37,8 +37,8 @@ TaskStatus DamageTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* DamageTask::CloneImpl()
+ITask* DamageTask::CloneImpl(Arena* arena)
 {
-    return new DamageTask(m_entityType, m_damage, m_isSpellDamage);
+    return new (arena) DamageTask(m_entityType, m_damage, m_isSpellDamage);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -31,8 +31,8 @@ TaskStatus DestroyTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* DestroyTask::CloneImpl()
+ITask* DestroyTask::CloneImpl(Arena* arena)
 {
-    return new DestroyTask(m_entityType);
+    return new (arena) DestroyTask(m_entityType);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -7,10 +7,6 @@
 #include <Rosetta/Tasks/SimpleTasks/DiscardTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/IncludeTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 DiscardTask::DiscardTask(EntityType entityType) : ITask(entityType)
@@ -42,8 +38,8 @@ TaskStatus DiscardTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* DiscardTask::CloneImpl()
+ITask* DiscardTask::CloneImpl(Arena* arena)
 {
-    return new DiscardTask(m_entityType);
+    return new (arena) DiscardTask(m_entityType);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -32,8 +32,8 @@ TaskStatus DrawNumberTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* DrawNumberTask::CloneImpl()
+ITask* DrawNumberTask::CloneImpl(Arena* arena)
 {
-    return new DrawNumberTask();
+    return new (arena) DrawNumberTask();
 }
 }  // namespace RosettaStone::SimpleTasks
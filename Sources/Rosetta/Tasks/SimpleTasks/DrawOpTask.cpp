@@ -28,8 +28,8 @@ TaskStatus DrawOpTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* DrawOpTask::CloneImpl()
+ITask* DrawOpTask::CloneImpl(Arena* arena)
 {
-    return new DrawOpTask(m_amount);
+    return new (arena) DrawOpTask(m_amount);
 }
 }  // namespace RosettaStone::SimpleTasks
\ No newline at end of file
@@ -36,8 +36,8 @@ TaskStatus DrawStackTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* DrawStackTask::CloneImpl()
+ITask* DrawStackTask::CloneImpl(Arena* arena)
 {
-    return new DrawStackTask(m_amount);
+    return new (arena) DrawStackTask(m_amount);
 }
 }  // namespace RosettaStone::SimpleTasks
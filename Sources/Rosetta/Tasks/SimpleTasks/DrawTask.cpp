@@ -48,8 +48,8 @@ TaskStatus DrawTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* DrawTask::CloneImpl()
+ITask* DrawTask::CloneImpl(Arena* arena)
 {
-    return new DrawTask(m_amount, m_toStack);
+    return new (arena) DrawTask(m_amount, m_toStack);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -39,8 +39,8 @@ TaskStatus EnqueueTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* EnqueueTask::CloneImpl()
+ITask* EnqueueTask::CloneImpl(Arena* arena)
 {
-    return new EnqueueTask(m_tasks, m_num, m_isSpellDamage);
+    return new (arena) EnqueueTask(m_tasks, m_num, m_isSpellDamage);
 }
 }  // namespace RosettaStone::SimpleTasks
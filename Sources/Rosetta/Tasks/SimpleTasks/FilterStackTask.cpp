@@ -72,16 +72,16 @@ TaskStatus FilterStackTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* FilterStackTask::CloneImpl()
+ITask* FilterStackTask::CloneImpl(Arena* arena)
 {
     if (m_selfCondition != nullptr)
     {
-        return new FilterStackTask(*m_selfCondition);
+        return new (arena) FilterStackTask(*m_selfCondition);
     }
 
     if (m_relaCondition != nullptr)
     {
-        return new FilterStackTask(m_entityType, *m_relaCondition);
+        return new (arena) FilterStackTask(m_entityType, *m_relaCondition);
     }
 
     return nullptr;
@@ -40,8 +40,8 @@ TaskStatus FlagTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* FlagTask::CloneImpl()
+ITask* FlagTask::CloneImpl(Arena* arena)
 {
-    return new FlagTask(m_flag, m_toDoTasks);
+    return new (arena) FlagTask(m_flag, m_toDoTasks);
 }
 }  // namespace RosettaStone::SimpleTasks
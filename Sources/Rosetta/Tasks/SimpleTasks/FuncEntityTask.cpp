@@ -33,8 +33,8 @@ TaskStatus FuncEntityTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* FuncEntityTask::CloneImpl()
+ITask* FuncEntityTask::CloneImpl(Arena* arena)
 {
-    return new FuncEntityTask(m_func);
+    return new (arena) FuncEntityTask(m_func);
 }
 }  // namespace RosettaStone::SimpleTasks
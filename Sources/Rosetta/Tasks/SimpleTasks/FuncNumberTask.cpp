@@ -30,8 +30,8 @@ TaskStatus FuncNumberTask::Impl(Player&)
     return TaskStatus::COMPLETE;
 }
 
-ITask* FuncNumberTask::CloneImpl()
+ITask* FuncNumberTask::CloneImpl(Arena* arena)
 {
-    return new FuncNumberTask(m_func);
+    return new (arena) FuncNumberTask(m_func);
 }
 }  // namespace RosettaStone::SimpleTasks
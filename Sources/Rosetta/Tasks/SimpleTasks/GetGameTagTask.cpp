@@ -55,9 +55,9 @@ TaskStatus GetGameTagTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* GetGameTagTask::CloneImpl()
+ITask* GetGameTagTask::CloneImpl(Arena* arena)
 {
-    return new GetGameTagTask(m_entityType, m_gameTag, m_entityIndex,
-                              m_numIndex);
+    return new (arena)
+        GetGameTagTask(m_entityType, m_gameTag, m_entityIndex, m_numIndex);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -32,8 +32,8 @@ TaskStatus HealFullTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* HealFullTask::CloneImpl()
+ITask* HealFullTask::CloneImpl(Arena* arena)
 {
-    return new HealFullTask(m_entityType);
+    return new (arena) HealFullTask(m_entityType);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -33,8 +33,8 @@ TaskStatus HealTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* HealTask::CloneImpl()
+ITask* HealTask::CloneImpl(Arena* arena)
 {
-    return new HealTask(m_entityType, m_amount);
+    return new (arena) HealTask(m_entityType, m_amount);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -44,19 +44,19 @@ std::vector<Entity*> IncludeTask::GetEntities(EntityType entityType,
             }
             break;
         case EntityType::ALL:
-            for (auto& minion : player.GetFieldZone().GetAll())
+            for (auto& minion : player.GetFieldZone().GetAlive())
             {
                 entities.emplace_back(minion);
             }
             entities.emplace_back(player.GetHero());
-            for (auto& minion : player.opponent->GetFieldZone().GetAll())
+            for (auto& minion : player.opponent->GetFieldZone().GetAlive())
             {
                 entities.emplace_back(minion);
             }
             entities.emplace_back(player.opponent->GetHero());
             break;
         case EntityType::ALL_NOSOURCE:
-            for (auto& minion : player.GetFieldZone().GetAll())
+            for (auto& minion : player.GetFieldZone().GetAlive())
             {
                 if (source == minion)
                 {
@@ -65,7 +65,7 @@ std::vector<Entity*> IncludeTask::GetEntities(EntityType entityType,
                 entities.emplace_back(minion);
             }
             entities.emplace_back(player.GetHero());
-            for (auto& minion : player.opponent->GetFieldZone().GetAll())
+            for (auto& minion : player.opponent->GetFieldZone().GetAlive())
             {
                 if (source == minion)
                 {
@@ -76,14 +76,14 @@ std::vector<Entity*> IncludeTask::GetEntities(EntityType entityType,
             entities.emplace_back(player.opponent->GetHero());
             break;
         case EntityType::FRIENDS:
-            for (auto& minion : player.GetFieldZone().GetAll())
+            for (auto& minion : player.GetFieldZone().GetAlive())
             {
                 entities.emplace_back(minion);
             }
             entities.emplace_back(player.GetHero());
             break;
         case EntityType::ENEMIES:
-            for (auto& minion : player.opponent->GetFieldZone().GetAll())
+            for (auto& minion : player.opponent->GetFieldZone().GetAlive())
             {
                 entities.emplace_back(minion);
             }
@@ -92,14 +92,14 @@ std::vector<Entity*> IncludeTask::GetEntities(EntityType entityType,
         case EntityType::ENEMIES_NOTARGET:
             if (target == player.opponent->GetHero())
             {
-                for (auto& minion : player.opponent->GetFieldZone().GetAll())
+                for (auto& minion : player.opponent->GetFieldZone().GetAlive())
                 {
                     entities.emplace_back(minion);
                 }
             }
             else
             {
-                for (auto& minion : player.opponent->GetFieldZone().GetAll())
+                for (auto& minion : player.opponent->GetFieldZone().GetAlive())
                 {
                     if (target == minion)
                     {
@@ -131,41 +131,41 @@ std::vector<Entity*> IncludeTask::GetEntities(EntityType entityType,
             }
             break;
         case EntityType::HAND:
-            for (auto& card : player.GetHandZone().GetAll())
+            for (auto& card : player.GetHandZone().GetAlive())
             {
                 entities.emplace_back(card);
             }
             break;
         case EntityType::ENEMY_HAND:
-            for (auto& card : player.opponent->GetHandZone().GetAll())
+            for (auto& card : player.opponent->GetHandZone().GetAlive())
             {
                 entities.emplace_back(card);
             }
             break;
         case EntityType::DECK:
-            for (auto& card : player.GetDeckZone().GetAll())
+            for (auto& card : player.GetDeckZone().GetAlive())
             {
                 entities.emplace_back(card);
             }
             break;
         case EntityType::ENEMY_DECK:
-            for (auto& card : player.opponent->GetDeckZone().GetAll())
+            for (auto& card : player.opponent->GetDeckZone().GetAlive())
             {
                 entities.emplace_back(card);
             }
             break;
         case EntityType::ALL_MINIONS:
-            for (auto& minion : player.GetFieldZone().GetAll())
+            for (auto& minion : player.GetFieldZone().GetAlive())
             {
                 entities.emplace_back(minion);
             }
-            for (auto& minion : player.opponent->GetFieldZone().GetAll())
+            for (auto& minion : player.opponent->GetFieldZone().GetAlive())
             {
                 entities.emplace_back(minion);
             }
             break;
         case EntityType::ALL_MINIONS_NOSOURCE:
-            for (auto& minion : player.GetFieldZone().GetAll())
+            for (auto& minion : player.GetFieldZone().GetAlive())
             {
                 if (source == minion)
                 {
@@ -174,7 +174,7 @@ std::vector<Entity*> IncludeTask::GetEntities(EntityType entityType,
 
                 entities.emplace_back(minion);
             }
-            for (auto& minion : player.opponent->GetFieldZone().GetAll())
+            for (auto& minion : player.opponent->GetFieldZone().GetAlive())
             {
                 if (source == minion)
                 {
@@ -185,13 +185,13 @@ std::vector<Entity*> IncludeTask::GetEntities(EntityType entityType,
             }
             break;
         case EntityType::MINIONS:
-            for (auto& minion : player.GetFieldZone().GetAll())
+            for (auto& minion : player.GetFieldZone().GetAlive())
             {
                 entities.emplace_back(minion);
             }
             break;
         case EntityType::MINIONS_NOSOURCE:
-            for (auto& minion : player.GetFieldZone().GetAll())
+            for (auto& minion : player.GetFieldZone().GetAlive())
             {
                 if (source == minion)
                 {
@@ -202,7 +202,7 @@ std::vector<Entity*> IncludeTask::GetEntities(EntityType entityType,
             }
             break;
         case EntityType::ENEMY_MINIONS:
-            for (auto& minion : player.opponent->GetFieldZone().GetAll())
+            for (auto& minion : player.opponent->GetFieldZone().GetAlive())
             {
                 entities.emplace_back(minion);
             }
@@ -255,8 +255,8 @@ TaskStatus IncludeTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* IncludeTask::CloneImpl()
+ITask* IncludeTask::CloneImpl(Arena* arena)
 {
-    return new IncludeTask(m_entityType, m_excludeTypes);
+    return new (arena) IncludeTask(m_entityType, m_excludeTypes);
 }
 }  // namespace RosettaStone::SimpleTasks
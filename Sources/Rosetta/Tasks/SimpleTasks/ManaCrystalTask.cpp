@@ -33,8 +33,8 @@ TaskStatus ManaCrystalTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* ManaCrystalTask::CloneImpl()
+ITask* ManaCrystalTask::CloneImpl(Arena* arena)
 {
-    return new ManaCrystalTask(m_amount, m_fill, m_isOpponent);
+    return new (arena) ManaCrystalTask(m_amount, m_fill, m_isOpponent);
 }
 }  // namespace RosettaStone::SimpleTasks
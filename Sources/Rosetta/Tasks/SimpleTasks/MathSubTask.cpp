@@ -47,8 +47,8 @@ TaskStatus MathSubTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* MathSubTask::CloneImpl()
+ITask* MathSubTask::CloneImpl(Arena* arena)
 {
-    return new MathSubTask(m_entityType, m_gameTag, m_amount);
+    return new (arena) MathSubTask(m_entityType, m_gameTag, m_amount);
 }
 }  // namespace RosettaStone::SimpleTasks
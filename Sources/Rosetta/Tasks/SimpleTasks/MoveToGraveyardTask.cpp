@@ -33,8 +33,8 @@ TaskStatus MoveToGraveyardTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* MoveToGraveyardTask::CloneImpl()
+ITask* MoveToGraveyardTask::CloneImpl(Arena* arena)
 {
-    return new MoveToGraveyardTask(m_entityType);
+    return new (arena) MoveToGraveyardTask(m_entityType);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -2,10 +2,6 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/RandomCardTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 RandomCardTask::RandomCardTask(CardType cardType, CardClass cardClass,
@@ -20,36 +16,23 @@ TaskID RandomCardTask::GetTaskID() const
     return TaskID::RANDOM_CARD;
 }
 
-std::vector<Card*> RandomCardTask::GetCardList(CardType cardType,
-                                               CardClass cardClass, Race race)
+const std::vector<Card*>& RandomCardTask::GetCardList(CardType cardType,
+                                                      CardClass cardClass,
+                                                      Race race)
 {
-    std::vector<Card*> result;
-    const auto cards = Cards::GetInstance().GetAllCards();
-
-    for (const auto& card : cards)
-    {
-        if ((cardType == CardType::INVALID ||
-             cardType == card->GetCardType()) &&
-            (cardClass == CardClass::INVALID ||
-             cardClass == card->GetCardClass()) &&
-            (race == Race::INVALID || race == card->GetRace()))
-        {
-            result.emplace_back(card);
-        }
-    }
-
-    return result;
+    return Cards::GetInstance().GetRandomCardPool(cardType, cardClass, race);
 }
 
 TaskStatus RandomCardTask::Impl(Player& player)
 {
-    auto cardsList = GetCardList(m_cardType, m_cardClass, m_race);
+    const auto& cardsList = GetCardList(m_cardType, m_cardClass, m_race);
     if (cardsList.empty())
     {
         return TaskStatus::STOP;
     }
 
-    const auto idx = Random::get<std::size_t>(0, cardsList.size() - 1);
+    const auto idx = player.GetGame()->random.Get<std::size_t>(
+        0, cardsList.size() - 1);
     auto randomCard = Entity::GetFromCard(player, cardsList.at(idx));
 
     player.GetGame()->taskStack.entities.clear();
@@ -58,8 +41,8 @@ TaskStatus RandomCardTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* RandomCardTask::CloneImpl()
+ITask* RandomCardTask::CloneImpl(Arena* arena)
 {
-    return new RandomCardTask(m_cardType, m_cardClass, m_race);
+    return new (arena) RandomCardTask(m_cardType, m_cardClass, m_race);
 }
 }  // namespace RosettaStone::SimpleTasks
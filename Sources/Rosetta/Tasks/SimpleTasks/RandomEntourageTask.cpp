@@ -7,10 +7,6 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/RandomEntourageTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 RandomEntourageTask::RandomEntourageTask(int count, bool isOpponent)
@@ -33,7 +29,9 @@ TaskStatus RandomEntourageTask::Impl(Player& player)
         return TaskStatus::STOP;
     }
 
-    if (m_count > static_cast<int>(m_source->card->entourages.size()))
+    const auto& entourageCards =
+        Cards::GetInstance().GetEntourageCards(m_source->card);
+    if (m_count > static_cast<int>(entourageCards.size()))
     {
         return TaskStatus::STOP;
     }
@@ -42,10 +40,9 @@ TaskStatus RandomEntourageTask::Impl(Player& player)
 
     for (int i = 0; i < m_count; ++i)
     {
-        const auto idx =
-            Random::get<std::size_t>(0, m_source->card->entourages.size() - 1);
-        const auto entourageCard =
-            Cards::GetInstance().FindCardByID(m_source->card->entourages[idx]);
+        const auto idx = player.GetGame()->random.Get<std::size_t>(
+            0, entourageCards.size() - 1);
+        Card* entourageCard = entourageCards[idx];
 
         Entity* entourageEntity = Entity::GetFromCard(player, entourageCard);
         player.GetGame()->taskStack.entities.emplace_back(entourageEntity);
@@ -54,8 +51,8 @@ TaskStatus RandomEntourageTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* RandomEntourageTask::CloneImpl()
+ITask* RandomEntourageTask::CloneImpl(Arena* arena)
 {
-    return new RandomEntourageTask(m_count, m_isOpponent);
+    return new (arena) RandomEntourageTask(m_count, m_isOpponent);
 }
 }  // namespace RosettaStone::SimpleTasks
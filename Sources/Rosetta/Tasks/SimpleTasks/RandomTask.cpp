@@ -7,10 +7,6 @@
 #include <Rosetta/Tasks/SimpleTasks/IncludeTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/RandomTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 RandomTask::RandomTask(EntityType entityType, int num)
@@ -33,7 +29,8 @@ TaskStatus RandomTask::Impl(Player& player)
 
     for (int i = 0; i < m_num && !entities.empty(); ++i)
     {
-        const auto idx = Random::get<std::size_t>(0, entities.size() - 1);
+        const auto idx = player.GetGame()->random.Get<std::size_t>(
+            0, entities.size() - 1);
 
         Entity* entity = entities.at(idx);
         entities.erase(entities.begin() + idx);
@@ -43,8 +40,8 @@ TaskStatus RandomTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* RandomTask::CloneImpl()
+ITask* RandomTask::CloneImpl(Arena* arena)
 {
-    return new RandomTask(m_entityType, m_num);
+    return new (arena) RandomTask(m_entityType, m_num);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -34,8 +34,8 @@ TaskStatus RemoveEnchantmentTask::Impl(Player&)
     return TaskStatus::COMPLETE;
 }
 
-ITask* RemoveEnchantmentTask::CloneImpl()
+ITask* RemoveEnchantmentTask::CloneImpl(Arena* arena)
 {
-    return new RemoveEnchantmentTask();
+    return new (arena) RemoveEnchantmentTask();
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -39,8 +39,8 @@ TaskStatus RemoveHandTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* RemoveHandTask::CloneImpl()
+ITask* RemoveHandTask::CloneImpl(Arena* arena)
 {
-    return new RemoveHandTask(m_entityType);
+    return new (arena) RemoveHandTask(m_entityType);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -34,8 +34,8 @@ TaskStatus ReturnHandTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* ReturnHandTask::CloneImpl()
+ITask* ReturnHandTask::CloneImpl(Arena* arena)
 {
-    return new ReturnHandTask(m_entityType);
+    return new (arena) ReturnHandTask(m_entityType);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -32,8 +32,8 @@ TaskStatus SetGameTagTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* SetGameTagTask::CloneImpl()
+ITask* SetGameTagTask::CloneImpl(Arena* arena)
 {
-    return new SetGameTagTask(m_entityType, m_gameTag, m_amount);
+    return new (arena) SetGameTagTask(m_entityType, m_gameTag, m_amount);
 }
 }  // namespace RosettaStone::SimpleTasks
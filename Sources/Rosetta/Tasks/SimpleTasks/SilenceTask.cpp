@@ -37,8 +37,8 @@ TaskStatus SilenceTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* SilenceTask::CloneImpl()
+ITask* SilenceTask::CloneImpl(Arena* arena)
 {
-    return new SilenceTask(m_entityType);
+    return new (arena) SilenceTask(m_entityType);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -129,8 +129,8 @@ TaskStatus SummonTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* SummonTask::CloneImpl()
+ITask* SummonTask::CloneImpl(Arena* arena)
 {
-    return new SummonTask(m_side, m_card, m_amount, m_toOpponent);
+    return new (arena) SummonTask(m_side, m_card, m_amount, m_toOpponent);
 }
 }  // namespace RosettaStone::SimpleTasks
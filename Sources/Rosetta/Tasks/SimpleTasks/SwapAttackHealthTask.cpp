@@ -45,8 +45,8 @@ TaskStatus SwapAttackHealthTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* SwapAttackHealthTask::CloneImpl()
+ITask* SwapAttackHealthTask::CloneImpl(Arena* arena)
 {
-    return new SwapAttackHealthTask(m_entityType, m_enchantmentID);
+    return new (arena) SwapAttackHealthTask(m_entityType, m_enchantmentID);
 }
 }  // namespace RosettaStone::SimpleTasks
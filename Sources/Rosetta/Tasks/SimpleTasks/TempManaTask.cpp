@@ -32,8 +32,8 @@ TaskStatus TempManaTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* TempManaTask::CloneImpl()
+ITask* TempManaTask::CloneImpl(Arena* arena)
 {
-    return new TempManaTask(m_amount);
+    return new (arena) TempManaTask(m_amount);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -79,8 +79,8 @@ TaskStatus TransformCopyTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* TransformCopyTask::CloneImpl()
+ITask* TransformCopyTask::CloneImpl(Arena* arena)
 {
-    return new TransformCopyTask();
+    return new (arena) TransformCopyTask();
 }
 }  // namespace RosettaStone::SimpleTasks
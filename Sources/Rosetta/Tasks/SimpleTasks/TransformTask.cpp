@@ -44,8 +44,8 @@ TaskStatus TransformTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* TransformTask::CloneImpl()
+ITask* TransformTask::CloneImpl(Arena* arena)
 {
-    return new TransformTask(m_entityType, m_cardID);
+    return new (arena) TransformTask(m_entityType, m_cardID);
 }
 }  // namespace RosettaStone::SimpleTasks
@@ -39,8 +39,8 @@ TaskStatus WeaponTask::Impl(Player& player)
     return TaskStatus::COMPLETE;
 }
 
-ITask* WeaponTask::CloneImpl()
+ITask* WeaponTask::CloneImpl(Arena* arena)
 {
-    return new WeaponTask(m_cardID);
+    return new (arena) WeaponTask(m_cardID);
 }
 }  // namespace RosettaStone::SimpleTasks
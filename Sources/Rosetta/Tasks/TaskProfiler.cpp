@@ -0,0 +1,191 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Cards/Card.hpp>
+#include <Rosetta/Tasks/TaskProfiler.hpp>
+
+#include <json/json.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#ifdef ROSETTASTONE_TASK_PROFILER
+namespace RosettaStone
+{
+//! The number of heap allocations of each thread.
+thread_local std::size_t g_numAllocations = 0;
+}  // namespace RosettaStone
+
+// NOTE: The global allocation functions are replaced to count the heap
+// allocations of tasks. The array and nothrow forms call these ones.
+void* operator new(std::size_t size)
+{
+    ++RosettaStone::g_numAllocations;
+
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+#endif
+
+namespace RosettaStone
+{
+void TaskProfile::Add(const TaskProfile& rhs)
+{
+    count += rhs.count;
+    totalTime += rhs.totalTime;
+    maxTime = std::max(maxTime, rhs.maxTime);
+    allocations += rhs.allocations;
+}
+
+bool TaskProfiler::IsEnabled()
+{
+#ifdef ROSETTASTONE_TASK_PROFILER
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::size_t TaskProfiler::GetNumAllocations()
+{
+#ifdef ROSETTASTONE_TASK_PROFILER
+    return g_numAllocations;
+#else
+    return 0;
+#endif
+}
+
+void TaskProfiler::Record(TaskID taskID, const Card* card,
+                          std::chrono::nanoseconds time,
+                          std::size_t allocations)
+{
+    TaskProfile profile;
+    profile.count = 1;
+    profile.totalTime = time;
+    profile.maxTime = time;
+    profile.allocations = allocations;
+
+    if (m_taskProfiles.empty())
+    {
+        m_taskProfiles.resize(static_cast<std::size_t>(TaskID::NUM_TASK_ID));
+    }
+    m_taskProfiles[static_cast<std::size_t>(taskID)].Add(profile);
+
+    if (card != nullptr)
+    {
+        m_cardProfiles[card->id].Add(profile);
+    }
+}
+
+void TaskProfiler::Merge(const TaskProfiler& rhs)
+{
+    if (m_taskProfiles.empty())
+    {
+        m_taskProfiles.resize(static_cast<std::size_t>(TaskID::NUM_TASK_ID));
+    }
+    for (std::size_t i = 0; i < rhs.m_taskProfiles.size(); ++i)
+    {
+        m_taskProfiles[i].Add(rhs.m_taskProfiles[i]);
+    }
+
+    for (auto& [cardID, profile] : rhs.m_cardProfiles)
+    {
+        m_cardProfiles[cardID].Add(profile);
+    }
+}
+
+void TaskProfiler::Clear()
+{
+    m_taskProfiles.clear();
+    m_cardProfiles.clear();
+}
+
+TaskProfile TaskProfiler::GetTaskProfile(TaskID taskID) const
+{
+    if (m_taskProfiles.empty())
+    {
+        return TaskProfile{};
+    }
+
+    return m_taskProfiles[static_cast<std::size_t>(taskID)];
+}
+
+const std::map<std::string, TaskProfile>& TaskProfiler::GetCardProfiles()
+    const
+{
+    return m_cardProfiles;
+}
+
+void TaskProfiler::WriteJson(std::ostream& os) const
+{
+    const auto toJson = [](const TaskProfile& profile) {
+        return nlohmann::json{
+            { "count", profile.count },
+            { "totalTime", profile.totalTime.count() },
+            { "maxTime", profile.maxTime.count() },
+            { "allocations", profile.allocations },
+        };
+    };
+
+    nlohmann::json tasks = nlohmann::json::object();
+    for (std::size_t i = 0; i < m_taskProfiles.size(); ++i)
+    {
+        if (m_taskProfiles[i].count > 0)
+        {
+            tasks[std::string(TASK_ID_STR[i])] = toJson(m_taskProfiles[i]);
+        }
+    }
+
+    nlohmann::json cards = nlohmann::json::object();
+    for (auto& [cardID, profile] : m_cardProfiles)
+    {
+        cards[cardID] = toJson(profile);
+    }
+
+    os << nlohmann::json{ { "tasks", tasks }, { "cards", cards } }.dump(4)
+       << '\n';
+}
+
+void TaskProfiler::WriteCsv(std::ostream& os) const
+{
+    const auto writeRow = [&os](const char* type, std::string_view key,
+                                const TaskProfile& profile) {
+        os << type << ',' << key << ',' << profile.count << ','
+           << profile.totalTime.count() << ',' << profile.maxTime.count()
+           << ',' << profile.allocations << '\n';
+    };
+
+    os << "type,key,count,totalTime,maxTime,allocations\n";
+
+    for (std::size_t i = 0; i < m_taskProfiles.size(); ++i)
+    {
+        if (m_taskProfiles[i].count > 0)
+        {
+            writeRow("task", TASK_ID_STR[i], m_taskProfiles[i]);
+        }
+    }
+
+    for (auto& [cardID, profile] : m_cardProfiles)
+    {
+        writeRow("card", cardID, profile);
+    }
+}
+}  // namespace RosettaStone
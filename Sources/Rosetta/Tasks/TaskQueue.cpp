@@ -3,18 +3,58 @@
 // RosettaStone is hearthstone simulator using C++ with reinforcement learning.
 // Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
 
+#include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/TaskQueue.hpp>
 
+#ifdef ROSETTASTONE_TASK_PROFILER
+#include <chrono>
+#endif
+
 namespace RosettaStone
 {
-std::queue<ITask*>& TaskQueue::GetCurrentQueue()
+void TaskQueue::CopyFrom(const TaskQueue& rhs, Game& game,
+                         const std::map<const Entity*, Entity*>& entities)
 {
-    return m_eventStack.empty() ? m_baseQueue : m_eventStack.top();
+    const auto findEntity = [&entities](Entity* entity) -> Entity* {
+        const auto iter = entities.find(entity);
+        return iter != entities.end() ? iter->second : nullptr;
+    };
+
+    m_tasks.clear();
+    m_frames.clear();
+
+    // Copy the tasks that are not processed yet in each frame
+    for (std::size_t i = 0; i < rhs.m_frames.size(); ++i)
+    {
+        const std::size_t end = i + 1 < rhs.m_frames.size()
+                                    ? rhs.m_frames[i + 1].begin
+                                    : rhs.m_tasks.size();
+        m_frames.emplace_back(Frame{ m_tasks.size(), m_tasks.size() });
+
+        for (std::size_t idx = rhs.m_frames[i].head; idx < end; ++idx)
+        {
+            ITask* task = rhs.m_tasks[idx]->Clone(&game.GetArena());
+
+            if (task->GetPlayer() != nullptr)
+            {
+                task->SetPlayer(
+                    task->GetPlayer()->playerType == PlayerType::PLAYER1
+                        ? &game.GetPlayer1()
+                        : &game.GetPlayer2());
+            }
+            task->SetSource(findEntity(task->GetSource()));
+            task->SetTarget(findEntity(task->GetTarget()));
+
+            m_tasks.emplace_back(task);
+        }
+    }
+
+    m_eventFlag = rhs.m_eventFlag;
 }
 
 bool TaskQueue::IsEmpty()
 {
-    return m_eventFlag || GetCurrentQueue().empty();
+    return m_eventFlag || m_frames.back().head == m_tasks.size();
 }
 
 void TaskQueue::StartEvent()
@@ -30,9 +70,11 @@ void TaskQueue::EndEvent()
         return;
     }
 
-    if (!m_eventStack.empty())
+    // Discard the frame on top except the base frame
+    if (m_frames.size() > 1)
     {
-        m_eventStack.pop();
+        m_tasks.resize(m_frames.back().begin);
+        m_frames.pop_back();
     }
 }
 
@@ -40,25 +82,47 @@ void TaskQueue::Enqueue(ITask* task)
 {
     if (m_eventFlag)
     {
-        if (!GetCurrentQueue().empty())
+        // The tasks of the event go to the current frame if it is empty
+        if (m_frames.back().head != m_tasks.size())
         {
-            m_eventStack.push(std::queue<ITask*>{});
+            m_frames.emplace_back(Frame{ m_tasks.size(), m_tasks.size() });
         }
 
         m_eventFlag = false;
     }
 
-    GetCurrentQueue().push(task);
+    m_tasks.emplace_back(task);
 }
 
 TaskStatus TaskQueue::Process()
 {
-    ITask* currentTask = GetCurrentQueue().front();
-    GetCurrentQueue().pop();
+    Frame& frame = m_frames.back();
+    ITask* currentTask = m_tasks[frame.head++];
     m_currentTask = currentTask;
 
+    // Reuse the space of the frame on top if all of its tasks are taken
+    if (frame.head == m_tasks.size())
+    {
+        m_tasks.resize(frame.begin);
+        frame.head = frame.begin;
+    }
+
+#ifdef ROSETTASTONE_TASK_PROFILER
+    // The source of the task can be changed in Run(), so keep its card
+    const TaskID taskID = currentTask->GetTaskID();
+    const Entity* source = currentTask->GetSource();
+    const Card* card = source != nullptr ? source->card : nullptr;
+    const std::size_t allocations = TaskProfiler::GetNumAllocations();
+    const auto start = std::chrono::steady_clock::now();
+#endif
+
     const TaskStatus status = currentTask->Run();
 
+#ifdef ROSETTASTONE_TASK_PROFILER
+    m_profiler.Record(taskID, card, std::chrono::steady_clock::now() - start,
+                      TaskProfiler::GetNumAllocations() - allocations);
+#endif
+
     if (currentTask->IsFreeable())
     {
         delete currentTask;
@@ -68,4 +132,14 @@ TaskStatus TaskQueue::Process()
 
     return status;
 }
+
+TaskProfiler& TaskQueue::GetProfiler()
+{
+    return m_profiler;
+}
+
+const TaskProfiler& TaskQueue::GetProfiler() const
+{
+    return m_profiler;
+}
 }  // namespace RosettaStone
@@ -46,6 +46,11 @@ ReducedBoardView Board::CreateView() const
     }
 }
 
+std::uint64_t Board::GetHash() const
+{
+    return m_game.GetHash(m_playerType);
+}
+
 CurrentPlayerBoardRefView Board::GetCurPlayerStateRefView() const
 {
     if (m_game.GetCurrentPlayer().playerType != m_playerType)
@@ -175,6 +175,18 @@ std::vector<Entity*> BoardRefView::GetHandCards() const
     }
 }
 
+EntityRange<Entity> BoardRefView::GetAliveHandCards() const
+{
+    if (m_playerType == PlayerType::PLAYER1)
+    {
+        return m_game.GetPlayer1().GetHandZone().GetAlive();
+    }
+    else
+    {
+        return m_game.GetPlayer2().GetHandZone().GetAlive();
+    }
+}
+
 std::vector<std::pair<Entity*, bool>> BoardRefView::GetOpponentHandCards() const
 {
     std::vector<Entity*> entities;
@@ -230,6 +242,18 @@ std::vector<Minion*> BoardRefView::GetMinions(PlayerType playerType) const
     }
 }
 
+EntityRange<Minion> BoardRefView::GetAliveMinions(PlayerType playerType) const
+{
+    if (playerType == PlayerType::PLAYER1)
+    {
+        return m_game.GetPlayer1().GetFieldZone().GetAlive();
+    }
+    else
+    {
+        return m_game.GetPlayer2().GetFieldZone().GetAlive();
+    }
+}
+
 int BoardRefView::GetDeckCardCount(PlayerType playerType) const
 {
     if (playerType == PlayerType::PLAYER1)
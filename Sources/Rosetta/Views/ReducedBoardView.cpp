@@ -10,6 +10,8 @@
 #include <Rosetta/Views/BoardRefView.hpp>
 #include <Rosetta/Views/ReducedBoardView.hpp>
 
+#include <cstring>
+
 namespace RosettaStone
 {
 ReducedBoardView::ReducedBoardView(const BoardRefView& view)
@@ -23,19 +25,19 @@ ReducedBoardView::ReducedBoardView(const BoardRefView& view)
         m_myWeapon.Fill(*view.GetWeapon(m_playerType));
     }
     m_myManaCrystal.Fill(view.GetCurrentPlayer());
-    for (auto& minion : view.GetMinions(m_playerType))
+    for (auto& minion : view.GetAliveMinions(m_playerType))
     {
-        ViewTypes::MyMinion myMinion;
+        ViewTypes::Minion myMinion;
         myMinion.Fill(*minion, minion->CanAttack());
 
-        m_myMinions.emplace_back(myMinion);
+        m_myMinions.push_back(myMinion);
     }
-    for (auto& card : view.GetHandCards())
+    for (auto& card : view.GetAliveHandCards())
     {
         ViewTypes::MyHandCard myHandCard;
         myHandCard.Fill(*card);
 
-        m_myHand.emplace_back(myHandCard);
+        m_myHand.push_back(myHandCard);
     }
     m_myDeck.Fill(view.GetDeckCardCount(m_playerType));
 
@@ -43,7 +45,7 @@ ReducedBoardView::ReducedBoardView(const BoardRefView& view)
         (m_playerType == PlayerType::PLAYER1 ? PlayerType::PLAYER2
                                              : PlayerType::PLAYER1);
 
-    m_opHero.Fill(*view.GetOpponentHero());
+    m_opHero.Fill(*view.GetOpponentHero(), false);
     m_opHeroPower.Fill(*view.GetHeroPower(opPlayerType));
     m_opWeapon.Invalidate();
     if (view.GetWeapon(opPlayerType) != nullptr)
@@ -51,34 +53,20 @@ ReducedBoardView::ReducedBoardView(const BoardRefView& view)
         m_opWeapon.Fill(*view.GetWeapon(opPlayerType));
     }
     m_opManaCrystal.Fill(*view.GetCurrentPlayer().opponent);
-    for (auto& minion : view.GetMinions(opPlayerType))
+    for (auto& minion : view.GetAliveMinions(opPlayerType))
     {
-        ViewTypes::MyMinion opMinion;
-        opMinion.Fill(*minion, minion->CanAttack());
+        ViewTypes::Minion opMinion;
+        opMinion.Fill(*minion, false);
 
-        m_opMinions.emplace_back(opMinion);
-    }
-    for (std::size_t i = 0; i < view.GetOpponentHandCards().size(); ++i)
-    {
-        ViewTypes::OpHandCard opHandCard;
-        m_opHand.emplace_back(opHandCard);
+        m_opMinions.push_back(opMinion);
     }
+    m_opHand.Fill(view.GetOpponentHandCardCount());
     m_opDeck.Fill(view.GetDeckCardCount(opPlayerType));
 }
 
 bool ReducedBoardView::operator==(const ReducedBoardView& rhs) const
 {
-    return (m_turn == rhs.m_turn) && (m_playerType == rhs.m_playerType) &&
-           (m_myHero == rhs.m_myHero) && (m_myHeroPower == rhs.m_myHeroPower) &&
-           (m_myWeapon == rhs.m_myWeapon) &&
-           (m_myManaCrystal == rhs.m_myManaCrystal) &&
-           (m_myMinions == rhs.m_myMinions) && (m_myHand == rhs.m_myHand) &&
-           (m_myDeck == rhs.m_myDeck) && (m_opHero == rhs.m_opHero) &&
-           (m_opHeroPower == rhs.m_opHeroPower) &&
-           (m_opWeapon == rhs.m_opWeapon) &&
-           (m_opManaCrystal == rhs.m_opManaCrystal) &&
-           (m_opMinions == rhs.m_opMinions) && (m_opHand == rhs.m_opHand) &&
-           (m_opDeck == rhs.m_opDeck);
+    return std::memcmp(this, &rhs, sizeof(ReducedBoardView)) == 0;
 }
 
 bool ReducedBoardView::operator!=(const ReducedBoardView& rhs) const
@@ -96,7 +84,7 @@ PlayerType ReducedBoardView::GetPlayerType() const
     return m_playerType;
 }
 
-const ViewTypes::MyHero& ReducedBoardView::GetMyHero() const
+const ViewTypes::Hero& ReducedBoardView::GetMyHero() const
 {
     return m_myHero;
 }
@@ -116,7 +104,7 @@ const ViewTypes::ManaCrystal& ReducedBoardView::GetMyManaCrystal() const
     return m_myManaCrystal;
 }
 
-const ViewTypes::MyMinions& ReducedBoardView::GetMyMinions() const
+const ViewTypes::Minions& ReducedBoardView::GetMyMinions() const
 {
     return m_myMinions;
 }
@@ -5,12 +5,9 @@
 // property of any third parties.
 
 #include <Rosetta/Commons/Constants.hpp>
+#include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Zones/DeckZone.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone
 {
 DeckZone::DeckZone(Player* player) : LimitedZone(MAX_DECK_SIZE)
@@ -37,6 +34,6 @@ void DeckZone::Add(Entity& entity, int zonePos)
 
 void DeckZone::Shuffle() const
 {
-    Random::shuffle(m_entities, m_entities + m_count);
+    m_owner->GetGame()->random.Shuffle(m_entities, m_entities + m_count);
 }
 }  // namespace RosettaStone
@@ -56,6 +56,7 @@ void FieldZone::Replace(Entity& oldEntity, Entity& newEntity)
     newEntity.zone = this;
 
     // Remove old entity
+    ZobristHash::Detach(oldEntity);
     RemoveAura(oldEntity);
     for (auto& aura : auras)
     {
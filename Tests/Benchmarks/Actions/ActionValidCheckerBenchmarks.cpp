@@ -0,0 +1,35 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/BenchmarkUtils.hpp>
+#include <benchmark/benchmark.h>
+
+#include <Rosetta/Actions/ActionValidChecker.hpp>
+#include <Rosetta/Games/Game.hpp>
+
+using namespace RosettaStone;
+
+static void BM_ActionValidChecker_Check(benchmark::State& state)
+{
+    GameConfig config = BenchmarkUtils::GenerateGameConfig();
+    config.skipMulligan = true;
+    config.autoRun = false;
+
+    Game game(config);
+    BenchmarkUtils::SetupMidGame(game, static_cast<int>(state.range(0)));
+
+    ActionValidChecker checker;
+
+    for (auto _ : state)
+    {
+        checker.Reset();
+        checker.Check(game);
+        benchmark::DoNotOptimize(checker.GetMainActionsCount());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ActionValidChecker_Check)->Arg(0)->Arg(4)->Arg(MAX_FIELD_SIZE);
@@ -0,0 +1,131 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <benchmark/benchmark.h>
+
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Commons/DeckCode.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/GameConfig.hpp>
+#include <Rosetta/Loaders/CardLoader.hpp>
+#include <Rosetta/Loaders/PowerLoader.hpp>
+
+using namespace RosettaStone;
+
+//! The deck code of the hunter deck that is used in DeckCode tests.
+const std::string HUNTER_DECK_CODE =
+    "AAECAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/"
+    "mWA76YAwA=";
+
+static void BM_Cards_FindCardByID(benchmark::State& state)
+{
+    const auto& cards = Cards::GetInstance().GetAllCards();
+    const std::string& id = cards.back()->id;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Cards::FindCardByID(id));
+    }
+}
+BENCHMARK(BM_Cards_FindCardByID);
+
+static void BM_Cards_FindCardByDbfID(benchmark::State& state)
+{
+    const auto& cards = Cards::GetInstance().GetAllCards();
+    const int dbfID = cards.back()->dbfID;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Cards::FindCardByDbfID(dbfID));
+    }
+}
+BENCHMARK(BM_Cards_FindCardByDbfID);
+
+static void BM_Cards_DecodeDeck(benchmark::State& state)
+{
+    Cards::GetInstance();
+
+    for (auto _ : state)
+    {
+        DeckInfo deck = DeckCode::Decode(HUNTER_DECK_CODE);
+        benchmark::DoNotOptimize(deck.GetPrimitiveDeck());
+    }
+}
+BENCHMARK(BM_Cards_DecodeDeck);
+
+static void BM_Cards_SetupGame(benchmark::State& state)
+{
+    Cards::GetInstance();
+
+    for (auto _ : state)
+    {
+        DeckInfo deck = DeckCode::Decode(HUNTER_DECK_CODE);
+        const std::vector<Card*> cards = deck.GetPrimitiveDeck();
+
+        GameConfig config;
+        config.player1Class = CardClass::HUNTER;
+        config.player2Class = CardClass::HUNTER;
+        config.startPlayer = PlayerType::PLAYER1;
+        config.doFillDecks = false;
+        config.autoRun = false;
+
+        for (std::size_t i = 0; i < cards.size(); ++i)
+        {
+            config.player1Deck[i] = *cards[i];
+            config.player2Deck[i] = *cards[i];
+        }
+
+        Game game(config);
+        game.StartGame();
+        game.ProcessUntil(Step::MAIN_START);
+        benchmark::DoNotOptimize(game.GetTurn());
+    }
+}
+BENCHMARK(BM_Cards_SetupGame);
+
+static void BM_Cards_FindCards(benchmark::State& state)
+{
+    Cards::GetInstance();
+
+    SearchFilter filter;
+    filter.playerClass = CardClass::MAGE;
+    filter.includeNeutral = true;
+    filter.cardType = CardType::MINION;
+    filter.onlyCollectible = true;
+    filter.costMin = 2;
+    filter.costMax = 4;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Cards::FindCards(filter));
+    }
+}
+BENCHMARK(BM_Cards_FindCards);
+
+//! Measures the startup of Cards::GetInstance(). The singleton can't be
+//! created again, so the card data and the powers are loaded into a fresh
+//! vector, which is the dominant cost of the startup.
+static void BM_Cards_Startup(benchmark::State& state)
+{
+    // NOTE: Powers need the singleton because some tasks find cards in
+    // their constructor.
+    Cards::GetInstance();
+
+    for (auto _ : state)
+    {
+        std::vector<Card*> cards;
+        CardLoader::Load(cards);
+        PowerLoader::Load(cards);
+
+        state.PauseTiming();
+        for (Card* card : cards)
+        {
+            delete card;
+        }
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_Cards_Startup)->Unit(benchmark::kMillisecond);
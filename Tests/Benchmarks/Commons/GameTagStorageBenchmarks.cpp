@@ -0,0 +1,110 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <benchmark/benchmark.h>
+
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Commons/GameTagStorage.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/GameConfig.hpp>
+
+#include <iterator>
+#include <map>
+
+using namespace RosettaStone;
+
+//! The game tags that hot predicates such as CanAttack() look up.
+constexpr GameTag LOOKUP_TAGS[] = {
+    GameTag::ATK,           GameTag::HEALTH,  GameTag::DAMAGE,
+    GameTag::EXHAUSTED,     GameTag::FROZEN,  GameTag::WINDFURY,
+    GameTag::CHARGE,        GameTag::TAUNT,   GameTag::STEALTH,
+    GameTag::DIVINE_SHIELD, GameTag::IMMUNE,  GameTag::NUM_ATTACKS_THIS_TURN,
+    GameTag::CANT_ATTACK,   GameTag::QUEST,   GameTag::ZONE,
+    GameTag::ZONE_POSITION,
+};
+
+//! The game tags that a minion on the field usually has.
+const std::map<GameTag, int> MINION_TAGS = {
+    { GameTag::ENTITY_ID, 10 }, { GameTag::CONTROLLER, 1 },
+    { GameTag::ZONE, 1 },       { GameTag::ZONE_POSITION, 1 },
+    { GameTag::CARDTYPE, 4 },   { GameTag::CARD_SET, 2 },
+    { GameTag::CLASS, 12 },     { GameTag::COLLECTIBLE, 1 },
+    { GameTag::RARITY, 1 },     { GameTag::FACTION, 3 },
+    { GameTag::COST, 4 },       { GameTag::ATK, 2 },
+    { GameTag::HEALTH, 7 },     { GameTag::DAMAGE, 0 },
+    { GameTag::SPELLPOWER, 0 }, { GameTag::OVERLOAD, 0 },
+    { GameTag::DURABILITY, 0 }, { GameTag::TAUNT, 1 },
+    { GameTag::CARDRACE, 0 },   { GameTag::EXHAUSTED, 0 },
+};
+
+static void BM_GameTag_StdMapLookup(benchmark::State& state)
+{
+    const std::map<GameTag, int> tags = MINION_TAGS;
+
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (auto tag : LOOKUP_TAGS)
+        {
+            const auto iter = tags.find(tag);
+            sum += iter == tags.end() ? 0 : iter->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(LOOKUP_TAGS));
+}
+BENCHMARK(BM_GameTag_StdMapLookup);
+
+static void BM_GameTag_StorageLookup(benchmark::State& state)
+{
+    const GameTagStorage tags(MINION_TAGS);
+
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (auto tag : LOOKUP_TAGS)
+        {
+            sum += tags.Get(tag);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(LOOKUP_TAGS));
+}
+BENCHMARK(BM_GameTag_StorageLookup);
+
+static void BM_GameTag_EntityGetGameTag(benchmark::State& state)
+{
+    // Loads card data before setting up the game
+    Cards::GetInstance();
+
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.StartGame();
+    game.ProcessUntil(Step::MAIN_START);
+
+    const Hero* hero = game.GetPlayer1().GetHero();
+
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (auto tag : LOOKUP_TAGS)
+        {
+            sum += hero->GetGameTag(tag);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(LOOKUP_TAGS));
+}
+BENCHMARK(BM_GameTag_EntityGetGameTag);
@@ -0,0 +1,43 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <benchmark/benchmark.h>
+
+#include <Rosetta/Enums/CardEnums.hpp>
+
+#include <iterator>
+
+using namespace RosettaStone;
+
+static void BM_CardEnums_StrToEnum_GameTag(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (const auto& name : GAME_TAG_STR)
+        {
+            benchmark::DoNotOptimize(StrToEnum<GameTag>(name));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(std::size(GAME_TAG_STR)));
+}
+BENCHMARK(BM_CardEnums_StrToEnum_GameTag);
+
+static void BM_CardEnums_StrToEnum_PlayReq(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (const auto& name : PLAY_REQ_STR)
+        {
+            benchmark::DoNotOptimize(StrToEnum<PlayReq>(name));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(std::size(PLAY_REQ_STR)));
+}
+BENCHMARK(BM_CardEnums_StrToEnum_PlayReq);
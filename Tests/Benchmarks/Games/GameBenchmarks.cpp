@@ -0,0 +1,64 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/BenchmarkUtils.hpp>
+#include <benchmark/benchmark.h>
+
+#include <Rosetta/Games/BatchRunner.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Policies/RandomPolicy.hpp>
+
+using namespace RosettaStone;
+
+static void BM_Game_RandomPolicy(benchmark::State& state)
+{
+    const GameConfig config = BenchmarkUtils::GenerateGameConfig();
+
+    RandomPolicy policy;
+
+    for (auto _ : state)
+    {
+        Game game(config);
+        game.GetPlayer1().policy = &policy;
+        game.GetPlayer2().policy = &policy;
+
+        game.PlayPolicy();
+        benchmark::DoNotOptimize(game.GetTurn());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Game_RandomPolicy)->Unit(benchmark::kMillisecond);
+
+static void BM_Game_BatchRunner(benchmark::State& state)
+{
+    const GameConfig config = BenchmarkUtils::GenerateGameConfig();
+
+    const auto policyFactory = []() {
+        return std::unique_ptr<IPolicy>(new RandomPolicy());
+    };
+    const BatchRunner runner(policyFactory, policyFactory,
+                             static_cast<std::size_t>(state.range(0)));
+
+    std::vector<std::uint64_t> seeds(1000);
+    for (std::size_t i = 0; i < seeds.size(); ++i)
+    {
+        seeds[i] = i;
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(runner.Run(config, seeds));
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(seeds.size()));
+}
+BENCHMARK(BM_Game_BatchRunner)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,63 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <benchmark/benchmark.h>
+
+#include <Rosetta/Loaders/CardLoader.hpp>
+
+#include <cstdio>
+
+using namespace RosettaStone;
+
+//! The path of binary card data that is used in CardLoader benchmarks.
+const std::string CARD_LOADER_BINARY_PATH = "CardLoaderBenchmarks.bin";
+
+static void BM_CardLoader_LoadFromJson(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::vector<Card*> cards;
+        CardLoader::LoadFromJson(RESOURCES_DIR "cards.json", cards);
+
+        state.PauseTiming();
+        for (Card* card : cards)
+        {
+            delete card;
+        }
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_CardLoader_LoadFromJson)->Unit(benchmark::kMillisecond);
+
+static void BM_CardLoader_LoadFromBinary(benchmark::State& state)
+{
+    std::vector<Card*> cards;
+    CardLoader::LoadFromJson(RESOURCES_DIR "cards.json", cards);
+    CardLoader::SaveToBinary(CARD_LOADER_BINARY_PATH,
+                             RESOURCES_DIR "cards.json", cards);
+
+    for (Card* card : cards)
+    {
+        delete card;
+    }
+
+    for (auto _ : state)
+    {
+        cards.clear();
+        CardLoader::LoadFromBinary(CARD_LOADER_BINARY_PATH,
+                                   RESOURCES_DIR "cards.json", cards);
+
+        state.PauseTiming();
+        for (Card* card : cards)
+        {
+            delete card;
+        }
+        state.ResumeTiming();
+    }
+
+    std::remove(CARD_LOADER_BINARY_PATH.c_str());
+}
+BENCHMARK(BM_CardLoader_LoadFromBinary)->Unit(benchmark::kMillisecond);
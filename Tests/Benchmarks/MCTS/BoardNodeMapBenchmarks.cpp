@@ -0,0 +1,58 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/BenchmarkUtils.hpp>
+#include <benchmark/benchmark.h>
+
+#include <MCTS/Selection/BoardNodeMap.hpp>
+#include <MCTS/Selection/TreeNode.hpp>
+
+#include <Rosetta/Games/Game.hpp>
+
+using namespace RosettaTorch;
+
+//! The number of distinct boards that the threads look up. Each board is
+//! created by the first thread that looks it up and is found by the others.
+constexpr int NUM_BENCHMARK_BOARDS = 1 << 12;
+
+static void BM_BoardNodeMap_GetOrCreateNode(benchmark::State& state)
+{
+    static MCTS::TreeNodePool pool;
+    static MCTS::BoardNodeMap* nodeMap = nullptr;
+    if (state.thread_index() == 0)
+    {
+        nodeMap = new MCTS::BoardNodeMap();
+    }
+
+    GameConfig config = BenchmarkUtils::GenerateGameConfig();
+    config.skipMulligan = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.StartGame();
+    game.ProcessUntil(Step::MAIN_START);
+    game.random.Seed(static_cast<std::uint64_t>(state.thread_index()));
+
+    Player& curPlayer = game.GetCurrentPlayer();
+    const Board board(game, curPlayer.playerType);
+
+    for (auto _ : state)
+    {
+        // Changing the used mana gives the board a different hash
+        curPlayer.SetUsedMana(
+            game.random.Get<int>(0, NUM_BENCHMARK_BOARDS - 1));
+        benchmark::DoNotOptimize(nodeMap->GetOrCreateNode(board, pool));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        delete nodeMap;
+        nodeMap = nullptr;
+    }
+}
+BENCHMARK(BM_BoardNodeMap_GetOrCreateNode)->ThreadRange(1, 16)->UseRealTime();
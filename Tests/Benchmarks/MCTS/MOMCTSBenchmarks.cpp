@@ -0,0 +1,40 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/BenchmarkUtils.hpp>
+#include <benchmark/benchmark.h>
+
+#include <MCTS/MOMCTS.hpp>
+#include <MCTS/Selection/TreeNode.hpp>
+#include <MCTS/Statistics/Statistics.hpp>
+
+#include <Rosetta/Games/Game.hpp>
+
+using namespace RosettaTorch;
+
+static void BM_MOMCTS_Iterate(benchmark::State& state)
+{
+    GameConfig config = BenchmarkUtils::GenerateGameConfig();
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doShuffle = false;
+    config.skipMulligan = true;
+
+    MCTS::TreeNodePool pool;
+    MCTS::TreeNode p1Tree(pool);
+    MCTS::TreeNode p2Tree(pool);
+    MCTS::Statistics<> statistics;
+    MCTS::MOMCTS mcts(p1Tree, p2Tree, statistics);
+
+    for (auto _ : state)
+    {
+        Game game(config);
+        game.random.Seed(static_cast<std::uint64_t>(state.iterations()));
+        mcts.Iterate(game);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MOMCTS_Iterate)->Unit(benchmark::kMicrosecond);
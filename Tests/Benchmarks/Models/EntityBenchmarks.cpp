@@ -0,0 +1,74 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/BenchmarkUtils.hpp>
+#include <benchmark/benchmark.h>
+
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Models/Player.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+
+using namespace RosettaStone;
+
+static void BM_Entity_GetGameTag(benchmark::State& state)
+{
+    GameConfig config = BenchmarkUtils::GenerateGameConfig();
+    config.skipMulligan = true;
+    config.autoRun = false;
+
+    Game game(config);
+    BenchmarkUtils::SetupMidGame(game, 4);
+
+    const std::vector<Minion*> minions =
+        game.GetCurrentPlayer().GetFieldZone().GetAll();
+    const std::array<GameTag, 6> tags = { GameTag::ATK,   GameTag::HEALTH,
+                                          GameTag::DAMAGE, GameTag::TAUNT,
+                                          GameTag::QUEST, GameTag::ECHO };
+
+    for (auto _ : state)
+    {
+        int sum = 0;
+
+        for (const auto minion : minions)
+        {
+            for (const auto tag : tags)
+            {
+                sum += minion->GetGameTag(tag);
+            }
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(minions.size() * tags.size()));
+}
+BENCHMARK(BM_Entity_GetGameTag);
+
+static void BM_Entity_GetFromCard(benchmark::State& state)
+{
+    GameConfig config = BenchmarkUtils::GenerateGameConfig();
+    config.skipMulligan = true;
+    config.autoRun = false;
+
+    Game game(config);
+    BenchmarkUtils::SetupMidGame(game, 0);
+
+    Player& player = game.GetCurrentPlayer();
+    Card* card = Cards::GetInstance().FindCardByID("CS2_182");
+
+    for (auto _ : state)
+    {
+        Entity* entity = Entity::GetFromCard(player, card, std::nullopt,
+                                             &player.GetFieldZone());
+        benchmark::DoNotOptimize(entity);
+        delete entity;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Entity_GetFromCard);
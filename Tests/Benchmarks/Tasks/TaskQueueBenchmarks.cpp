@@ -0,0 +1,75 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/BenchmarkUtils.hpp>
+#include <benchmark/benchmark.h>
+
+#include <Rosetta/Actions/Draw.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
+
+#include <memory>
+
+using namespace RosettaStone;
+using namespace PlayerTasks;
+
+//! Plays minions and spells on the boards that are filled with Knife
+//! Juggler, Wild Pyromancer, Acolyte of Pain and so on, so that each card
+//! fires a chain of nested trigger events.
+static void BM_TaskQueue_TriggerDenseBoard(benchmark::State& state)
+{
+    GameConfig config = BenchmarkUtils::GenerateGameConfig();
+    config.startPlayer = PlayerType::PLAYER1;
+    config.skipMulligan = true;
+    config.autoRun = false;
+
+    const std::array<std::string, 6> friendIDs = {
+        "NEW1_019", "NEW1_019", "NEW1_020", "NEW1_020", "EX1_007", "EX1_509"
+    };
+    const std::array<std::string, 6> enemyIDs = {
+        "NEW1_019", "NEW1_020", "EX1_007", "EX1_007", "EX1_412", "EX1_390"
+    };
+
+    std::unique_ptr<Game> game;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+
+        game = std::make_unique<Game>(config);
+        game->StartGame();
+        game->ProcessUntil(Step::MAIN_ACTION);
+
+        Player& curPlayer = game->GetCurrentPlayer();
+        Player& opPlayer = game->GetOpponentPlayer();
+        curPlayer.SetTotalMana(10);
+        curPlayer.SetUsedMana(0);
+
+        for (std::size_t i = 0; i < friendIDs.size(); ++i)
+        {
+            BenchmarkUtils::SummonMinion(curPlayer, friendIDs[i]);
+            BenchmarkUtils::SummonMinion(opPlayer, enemyIDs[i]);
+        }
+
+        const auto wisp =
+            Generic::DrawCard(curPlayer, Cards::FindCardByID("CS2_231"));
+        const auto explosion =
+            Generic::DrawCard(curPlayer, Cards::FindCardByID("CS2_025"));
+        const auto missiles =
+            Generic::DrawCard(curPlayer, Cards::FindCardByID("EX1_277"));
+
+        state.ResumeTiming();
+
+        game->Process(curPlayer, PlayCardTask::Minion(wisp));
+        game->Process(curPlayer, PlayCardTask::Spell(missiles));
+        game->Process(curPlayer, PlayCardTask::Spell(explosion));
+        benchmark::DoNotOptimize(game->GetTurn());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TaskQueue_TriggerDenseBoard)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,73 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/BenchmarkUtils.hpp>
+
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Models/Player.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+
+namespace BenchmarkUtils
+{
+GameConfig GenerateGameConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::ROGUE;
+    config.player2Class = CardClass::PALADIN;
+    config.startPlayer = PlayerType::RANDOM;
+    config.doShuffle = true;
+    config.doFillDecks = false;
+    config.skipMulligan = false;
+    config.autoRun = true;
+
+    const std::array<std::string, START_DECK_SIZE> deck = {
+        "CS2_106", "CS2_105", "CS1_112", "CS1_112",  // 1
+        "CS1_113", "CS1_113", "CS1_130", "CS1_130",  // 2
+        "CS2_007", "CS2_007", "CS2_022", "CS2_022",  // 3
+        "CS2_023", "CS2_023", "CS2_024", "CS2_024",  // 4
+        "CS2_025", "CS2_025", "CS2_026", "CS2_026",  // 5
+        "CS2_027", "CS2_027", "CS2_029", "CS2_029",  // 6
+        "CS2_032", "CS2_032", "CS2_033", "CS2_033",  // 7
+        "CS2_037", "CS2_037"
+    };
+
+    for (std::size_t i = 0; i < START_DECK_SIZE; ++i)
+    {
+        config.player1Deck[i] = *Cards::GetInstance().FindCardByID(deck[i]);
+        config.player2Deck[i] = *Cards::GetInstance().FindCardByID(deck[i]);
+    }
+
+    return config;
+}
+
+void SetupMidGame(Game& game, int numMinions)
+{
+    game.StartGame();
+    game.ProcessUntil(Step::MAIN_START);
+
+    const std::array<std::string, 4> minionIDs = { "CS2_182", "CS2_120",
+                                                   "CS2_186", "CS2_200" };
+
+    for (auto player : { &game.GetPlayer1(), &game.GetPlayer2() })
+    {
+        for (int i = 0;
+             i < numMinions && !player->GetFieldZone().IsFull(); ++i)
+        {
+            SummonMinion(*player, minionIDs[i % minionIDs.size()]);
+        }
+    }
+}
+
+void SummonMinion(Player& player, const std::string& cardID)
+{
+    FieldZone& fieldZone = player.GetFieldZone();
+
+    Card* card = Cards::GetInstance().FindCardByID(cardID);
+    Entity* minion =
+        Entity::GetFromCard(player, card, std::nullopt, &fieldZone);
+    fieldZone.Add(*minion);
+}
+}  // namespace BenchmarkUtils
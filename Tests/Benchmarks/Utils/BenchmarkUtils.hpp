@@ -0,0 +1,24 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BENCHMARKS_BENCHMARK_UTILS_HPP
+#define BENCHMARKS_BENCHMARK_UTILS_HPP
+
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/GameConfig.hpp>
+
+using namespace RosettaStone;
+
+namespace BenchmarkUtils
+{
+GameConfig GenerateGameConfig();
+
+void SetupMidGame(Game& game, int numMinions);
+
+void SummonMinion(Player& player, const std::string& cardID);
+}  // namespace BenchmarkUtils
+
+#endif  // BENCHMARKS_BENCHMARK_UTILS_HPP
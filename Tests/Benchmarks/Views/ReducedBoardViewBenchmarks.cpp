@@ -0,0 +1,56 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/BenchmarkUtils.hpp>
+#include <benchmark/benchmark.h>
+
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Views/BoardRefView.hpp>
+#include <Rosetta/Views/ReducedBoardView.hpp>
+
+using namespace RosettaStone;
+
+static void BM_ReducedBoardView_Construct(benchmark::State& state)
+{
+    GameConfig config = BenchmarkUtils::GenerateGameConfig();
+    config.skipMulligan = true;
+    config.autoRun = false;
+
+    Game game(config);
+    BenchmarkUtils::SetupMidGame(game, static_cast<int>(state.range(0)));
+
+    const BoardRefView refView(game, game.GetCurrentPlayer().playerType);
+
+    for (auto _ : state)
+    {
+        ReducedBoardView view(refView);
+        benchmark::DoNotOptimize(view);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ReducedBoardView_Construct)->Arg(0)->Arg(MAX_FIELD_SIZE);
+
+static void BM_ReducedBoardView_Hash(benchmark::State& state)
+{
+    GameConfig config = BenchmarkUtils::GenerateGameConfig();
+    config.skipMulligan = true;
+    config.autoRun = false;
+
+    Game game(config);
+    BenchmarkUtils::SetupMidGame(game, static_cast<int>(state.range(0)));
+
+    const ReducedBoardView view = game.CreateView();
+    const std::hash<ReducedBoardView> hasher;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(hasher(view));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ReducedBoardView_Hash)->Arg(0)->Arg(MAX_FIELD_SIZE);
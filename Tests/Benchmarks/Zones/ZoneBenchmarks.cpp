@@ -0,0 +1,90 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/BenchmarkUtils.hpp>
+#include <benchmark/benchmark.h>
+
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Models/Player.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+#include <Rosetta/Zones/HandZone.hpp>
+
+using namespace RosettaStone;
+
+static void BM_FieldZone_AddRemove(benchmark::State& state)
+{
+    GameConfig config = BenchmarkUtils::GenerateGameConfig();
+    config.skipMulligan = true;
+    config.autoRun = false;
+
+    Game game(config);
+    BenchmarkUtils::SetupMidGame(game, 4);
+
+    Player& player = game.GetCurrentPlayer();
+    FieldZone& fieldZone = player.GetFieldZone();
+    Entity* minion = Entity::GetFromCard(
+        player, Cards::GetInstance().FindCardByID("CS2_182"), std::nullopt,
+        &fieldZone);
+
+    for (auto _ : state)
+    {
+        fieldZone.Add(*minion, 0);
+        fieldZone.Remove(*minion);
+    }
+
+    delete minion;
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FieldZone_AddRemove);
+
+static void BM_HandZone_AddRemove(benchmark::State& state)
+{
+    GameConfig config = BenchmarkUtils::GenerateGameConfig();
+    config.skipMulligan = true;
+    config.autoRun = false;
+
+    Game game(config);
+    BenchmarkUtils::SetupMidGame(game, 0);
+
+    Player& player = game.GetCurrentPlayer();
+    HandZone& handZone = player.GetHandZone();
+    Entity* card = Entity::GetFromCard(
+        player, Cards::GetInstance().FindCardByID("CS2_182"), std::nullopt,
+        &handZone);
+
+    for (auto _ : state)
+    {
+        handZone.Add(*card, 0);
+        handZone.Remove(*card);
+    }
+
+    delete card;
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HandZone_AddRemove);
+
+static void BM_FieldZone_GetAll(benchmark::State& state)
+{
+    GameConfig config = BenchmarkUtils::GenerateGameConfig();
+    config.skipMulligan = true;
+    config.autoRun = false;
+
+    Game game(config);
+    BenchmarkUtils::SetupMidGame(game, static_cast<int>(state.range(0)));
+
+    FieldZone& fieldZone = game.GetCurrentPlayer().GetFieldZone();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fieldZone.GetAll());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FieldZone_GetAll)->DenseRange(1, MAX_FIELD_SIZE, 3);
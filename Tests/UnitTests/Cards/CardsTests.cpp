@@ -9,6 +9,8 @@
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Enums/CardEnums.hpp>
 
+#include <algorithm>
+
 using namespace RosettaStone;
 
 TEST(Cards, GetAllCards)
@@ -182,6 +184,18 @@ TEST(Cards, FindCardByCost)
 
     EXPECT_FALSE(cards1.empty());
     EXPECT_TRUE(cards2.empty());
+
+    // The cards of several costs are in the order of all cards
+    std::vector<Card*> cards3;
+    for (Card* card : instance.GetAllCards())
+    {
+        if (card->gameTags.at(GameTag::COST) <= 1)
+        {
+            cards3.emplace_back(card);
+        }
+    }
+
+    EXPECT_EQ(cards1, cards3);
 }
 
 TEST(Cards, FindCardByAttack)
@@ -222,6 +236,83 @@ TEST(Cards, FindCardByGameTag)
     EXPECT_TRUE(cards2.empty());
 }
 
+TEST(Cards, FindCards)
+{
+    Cards& instance = Cards::GetInstance();
+
+    SearchFilter filter;
+    filter.playerClass = CardClass::MAGE;
+    filter.includeNeutral = true;
+    filter.cardType = CardType::SPELL;
+    filter.onlyCollectible = true;
+    filter.costMin = 1;
+    filter.costMax = 1;
+
+    std::vector<Card*> expected;
+    for (Card* card : instance.GetAllCards())
+    {
+        if ((card->GetCardClass() == CardClass::MAGE ||
+             card->GetCardClass() == CardClass::NEUTRAL) &&
+            card->GetCardType() == CardType::SPELL &&
+            card->gameTags.at(GameTag::COLLECTIBLE) == 1 &&
+            card->gameTags.at(GameTag::COST) == 1)
+        {
+            expected.emplace_back(card);
+        }
+    }
+
+    std::vector<Card*> cards1 = instance.FindCards(filter);
+    EXPECT_FALSE(cards1.empty());
+    EXPECT_EQ(cards1, expected);
+    EXPECT_NE(std::find(cards1.begin(), cards1.end(),
+                        instance.FindCardByName("Arcane Missiles")),
+              cards1.end());
+
+    filter.name = "Missiles";
+    std::vector<Card*> cards2 = instance.FindCards(filter);
+    EXPECT_EQ(cards2.size(), 1u);
+
+    const std::vector<Card*> cards3 = instance.FindCards(SearchFilter());
+    EXPECT_EQ(cards3.size(), instance.GetAllCards().size());
+}
+
+TEST(Cards, GetRandomCardPool)
+{
+    Cards& instance = Cards::GetInstance();
+
+    const auto& cards1 = instance.GetRandomCardPool(
+        CardType::MINION, CardClass::INVALID, Race::DRAGON);
+    const auto& cards2 = instance.GetRandomCardPool(
+        CardType::INVALID, CardClass::INVALID, Race::INVALID);
+
+    EXPECT_FALSE(cards1.empty());
+    for (const Card* card : cards1)
+    {
+        EXPECT_EQ(card->GetCardType(), CardType::MINION);
+        EXPECT_EQ(card->GetRace(), Race::DRAGON);
+    }
+    EXPECT_EQ(cards2, instance.GetAllCards());
+    EXPECT_EQ(&cards1, &instance.GetRandomCardPool(
+                           CardType::MINION, CardClass::INVALID, Race::DRAGON));
+}
+
+TEST(Cards, GetEntourageCards)
+{
+    Cards& instance = Cards::GetInstance();
+
+    const Card* ysera = instance.FindCardByName("Ysera");
+    const auto& cards1 = instance.GetEntourageCards(ysera);
+    const auto& cards2 =
+        instance.GetEntourageCards(instance.FindCardByName("Wisp"));
+
+    EXPECT_EQ(cards1.size(), ysera->entourages.size());
+    for (std::size_t i = 0; i < cards1.size(); ++i)
+    {
+        EXPECT_EQ(cards1[i]->id, ysera->entourages[i]);
+    }
+    EXPECT_TRUE(cards2.empty());
+}
+
 TEST(Cards, GetHeroCard)
 {
     Cards& instance = Cards::GetInstance();
@@ -0,0 +1,121 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "gtest/gtest.h"
+
+#include <Rosetta/Commons/Arena.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/GameConfig.hpp>
+#include <Rosetta/Tasks/SimpleTasks/DamageTask.hpp>
+
+using namespace RosettaStone;
+
+struct ArenaTestObject : public ArenaObject
+{
+    explicit ArenaTestObject(int _value) : value(_value)
+    {
+        // Do nothing
+    }
+
+    int value = 0;
+};
+
+TEST(Arena, AllocateAndDeallocate)
+{
+    Arena arena;
+    EXPECT_EQ(arena.GetNumBlocks(), 0u);
+
+    void* ptr1 = arena.Allocate(24);
+    void* ptr2 = arena.Allocate(24);
+    EXPECT_NE(ptr1, ptr2);
+    EXPECT_EQ(arena.GetNumBlocks(), 1u);
+
+    // The freed memory is reused by the allocation of the same size class
+    arena.Deallocate(ptr1, 24);
+    EXPECT_EQ(arena.Allocate(32), ptr1);
+
+    // The allocation of other size class doesn't reuse it
+    arena.Deallocate(ptr2, 24);
+    EXPECT_NE(arena.Allocate(64), ptr2);
+
+    // The large allocation comes from global allocator and is tracked
+    void* ptr3 = arena.Allocate(Arena::MAX_ALLOC_SIZE + 1);
+    void* ptr4 = arena.Allocate(Arena::MAX_ALLOC_SIZE * 2);
+    void* ptr5 = arena.Allocate(Arena::MAX_ALLOC_SIZE * 3);
+    EXPECT_EQ(arena.GetNumBlocks(), 1u);
+    EXPECT_EQ(arena.GetNumLargeBlocks(), 3u);
+    arena.Deallocate(ptr4, Arena::MAX_ALLOC_SIZE * 2);
+    arena.Deallocate(ptr3, Arena::MAX_ALLOC_SIZE + 1);
+    EXPECT_EQ(arena.GetNumLargeBlocks(), 1u);
+    static_cast<char*>(ptr5)[Arena::MAX_ALLOC_SIZE * 3 - 1] = 0;
+
+    // The large blocks that are not deallocated are released with the arena
+    arena.Allocate(Arena::MAX_ALLOC_SIZE * 4);
+    EXPECT_EQ(arena.GetNumLargeBlocks(), 2u);
+
+    for (std::size_t i = 0; i < Arena::BLOCK_SIZE / 512; ++i)
+    {
+        arena.Allocate(512);
+    }
+    EXPECT_EQ(arena.GetNumBlocks(), 2u);
+
+    arena.Release();
+    EXPECT_EQ(arena.GetNumBlocks(), 0u);
+    EXPECT_EQ(arena.GetNumLargeBlocks(), 0u);
+}
+
+TEST(Arena, ArenaObject)
+{
+    Arena arena;
+
+    auto obj1 = new (&arena) ArenaTestObject(1);
+    auto obj2 = new ArenaTestObject(2);
+    EXPECT_EQ(obj1->value, 1);
+    EXPECT_EQ(obj2->value, 2);
+    EXPECT_EQ(arena.GetNumBlocks(), 1u);
+
+    // The memory of the object is returned to the arena
+    delete obj1;
+    auto obj3 = new (&arena) ArenaTestObject(3);
+    EXPECT_EQ(obj3, obj1);
+
+    delete obj2;
+    delete obj3;
+}
+
+TEST(Arena, Game)
+{
+    GameConfig config;
+    config.player1Class = CardClass::PRIEST;
+    config.player2Class = CardClass::WARLOCK;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    EXPECT_EQ(game.GetArena().GetNumBlocks(), 1u);
+
+    const auto clone = game.Clone();
+    EXPECT_EQ(clone->GetArena().GetNumBlocks(), 1u);
+}
+
+TEST(Arena, Task)
+{
+    Arena arena;
+
+    SimpleTasks::DamageTask task(EntityType::ENEMIES, 1);
+    ITask* clonedTask1 = task.Clone(&arena);
+    EXPECT_TRUE(clonedTask1->IsFreeable());
+    EXPECT_EQ(clonedTask1->GetEntityType(), EntityType::ENEMIES);
+    EXPECT_EQ(arena.GetNumBlocks(), 1u);
+
+    // The cloned task of the same type reuses the memory
+    delete clonedTask1;
+    ITask* clonedTask2 = task.Clone(&arena);
+    EXPECT_EQ(clonedTask2, clonedTask1);
+
+    delete clonedTask2;
+}
@@ -0,0 +1,60 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "gtest/gtest.h"
+
+#include <Rosetta/Commons/GameTagStorage.hpp>
+
+using namespace RosettaStone;
+
+TEST(GameTagStorage, SetAndGet)
+{
+    GameTagStorage storage;
+
+    // Hot game tag
+    EXPECT_FALSE(storage.Contains(GameTag::ATK));
+    EXPECT_EQ(storage.Find(GameTag::ATK), nullptr);
+    EXPECT_EQ(storage.Get(GameTag::ATK), 0);
+
+    storage.Set(GameTag::ATK, 0);
+    EXPECT_TRUE(storage.Contains(GameTag::ATK));
+    EXPECT_EQ(storage.Get(GameTag::ATK), 0);
+
+    storage.Set(GameTag::ATK, 5);
+    EXPECT_EQ(*storage.Find(GameTag::ATK), 5);
+
+    // Rare game tags
+    storage.Set(GameTag::QUEST, 3);
+    storage.Set(GameTag::ADAPT, 1);
+    storage.Set(GameTag::QUEST, 4);
+    EXPECT_EQ(storage.Get(GameTag::QUEST), 4);
+    EXPECT_EQ(storage.Get(GameTag::ADAPT), 1);
+    EXPECT_FALSE(storage.Contains(GameTag::ECHO));
+
+    const auto tags = storage.ToMap();
+    EXPECT_EQ(tags.size(), 3u);
+    EXPECT_EQ(tags.at(GameTag::ATK), 5);
+    EXPECT_EQ(tags.at(GameTag::QUEST), 4);
+    EXPECT_EQ(tags.at(GameTag::ADAPT), 1);
+}
+
+TEST(GameTagStorage, Erase)
+{
+    GameTagStorage storage({ { GameTag::HEALTH, 2 },
+                             { GameTag::TAUNT, 1 },
+                             { GameTag::QUEST, 1 } });
+
+    storage.Erase(GameTag::TAUNT);
+    storage.Erase(GameTag::QUEST);
+    storage.Erase(GameTag::ECHO);
+    EXPECT_FALSE(storage.Contains(GameTag::TAUNT));
+    EXPECT_FALSE(storage.Contains(GameTag::QUEST));
+    EXPECT_EQ(storage.Get(GameTag::HEALTH), 2);
+
+    storage.Clear();
+    EXPECT_FALSE(storage.Contains(GameTag::HEALTH));
+    EXPECT_TRUE(storage.ToMap().empty());
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "gtest/gtest.h"
+
+#include <Rosetta/Commons/Random.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+using namespace RosettaStone;
+
+TEST(Random, Seed)
+{
+    Random random1(42);
+    Random random2(42);
+    Random random3(43);
+
+    bool isDifferent = false;
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto value = random1();
+        EXPECT_EQ(value, random2());
+        isDifferent |= value != random3();
+    }
+    EXPECT_TRUE(isDifferent);
+
+    random1.Seed(7);
+    random2.Seed(7);
+    EXPECT_EQ(random1(), random2());
+}
+
+TEST(Random, Get)
+{
+    Random random(1);
+
+    bool hasMin = false, hasMax = false;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const int value = random.Get(-2, 2);
+        EXPECT_GE(value, -2);
+        EXPECT_LE(value, 2);
+        hasMin |= value == -2;
+        hasMax |= value == 2;
+
+        const float ratio = random.Get(0.0f, 1.0f);
+        EXPECT_GE(ratio, 0.0f);
+        EXPECT_LE(ratio, 1.0f);
+    }
+    EXPECT_TRUE(hasMin);
+    EXPECT_TRUE(hasMax);
+    EXPECT_EQ(random.Get<std::size_t>(3, 3), 3u);
+
+    std::vector<int> values = { 1, 2, 3 };
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto iter = random.Get(values);
+        EXPECT_NE(iter, values.end());
+    }
+
+    std::vector<int> emptyValues;
+    EXPECT_THROW(random.Get(emptyValues), std::out_of_range);
+}
+
+TEST(Random, Shuffle)
+{
+    Random random(2);
+
+    std::vector<int> values(30);
+    std::iota(values.begin(), values.end(), 0);
+
+    std::vector<int> shuffled = values;
+    random.Shuffle(shuffled.begin(), shuffled.end());
+    EXPECT_NE(shuffled, values);
+
+    std::sort(shuffled.begin(), shuffled.end());
+    EXPECT_EQ(shuffled, values);
+}
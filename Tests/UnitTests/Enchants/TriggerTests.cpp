@@ -11,6 +11,8 @@
 #include <Rosetta/Enchants/Trigger.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Games/GameConfig.hpp>
+#include <Rosetta/Tasks/PlayerTasks/EndTurnTask.hpp>
+#include <Rosetta/Tasks/SimpleTasks/DamageTask.hpp>
 
 using namespace RosettaStone;
 using namespace TestUtils;
@@ -660,4 +662,51 @@ TEST(Trigger, Target)
 
     curField[0]->Destroy();
     game.ProcessDestroyAndUpdateAura();
-}
\ No newline at end of file
+}
+
+TEST(Trigger, MultipleListeners)
+{
+    GameConfig config;
+    config.player1Class = CardClass::SHAMAN;
+    config.player2Class = CardClass::WARLOCK;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.StartGame();
+    game.ProcessUntil(Step::MAIN_START);
+
+    Player& curPlayer = game.GetCurrentPlayer();
+    Player& opPlayer = game.GetOpponentPlayer();
+    curPlayer.SetTotalMana(10);
+    curPlayer.SetUsedMana(0);
+    opPlayer.SetTotalMana(10);
+    opPlayer.SetUsedMana(0);
+
+    auto& curField = curPlayer.GetFieldZone();
+
+    auto card1 = GenerateMinionCard("minion1", 3, 6);
+    card1.power.AddTrigger(new Trigger(TriggerType::TURN_END));
+    card1.power.GetTrigger()->tasks = { new SimpleTasks::DamageTask(
+        EntityType::ENEMY_HERO, 1) };
+
+    PlayMinionCard(curPlayer, &card1);
+    PlayMinionCard(curPlayer, &card1);
+    PlayMinionCard(curPlayer, &card1);
+    EXPECT_EQ(game.triggerManager.endTurnTrigger.GetCount(), 3u);
+
+    game.Process(curPlayer, PlayerTasks::EndTurnTask());
+    game.ProcessUntil(Step::MAIN_START);
+    EXPECT_EQ(opPlayer.GetHero()->GetHealth(), 27);
+
+    curField[1]->Destroy();
+    game.ProcessDestroyAndUpdateAura();
+    EXPECT_EQ(game.triggerManager.endTurnTrigger.GetCount(), 2u);
+
+    game.Process(opPlayer, PlayerTasks::EndTurnTask());
+    game.ProcessUntil(Step::MAIN_START);
+    game.Process(curPlayer, PlayerTasks::EndTurnTask());
+    game.ProcessUntil(Step::MAIN_START);
+    EXPECT_EQ(opPlayer.GetHero()->GetHealth(), 25);
+}
@@ -0,0 +1,38 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "gtest/gtest.h"
+
+#include <Rosetta/Enums/CardEnums.hpp>
+
+using namespace RosettaStone;
+
+template <class T, std::size_t N>
+void CheckAllEnums(const std::string_view (&names)[N])
+{
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        EXPECT_EQ(StrToEnum<T>(names[i]), T(i));
+        EXPECT_EQ(EnumToStr<T>(T(i)), names[i]);
+    }
+}
+
+TEST(CardEnums, StrToEnum)
+{
+    CheckAllEnums<CardClass>(CARD_CLASS_STR);
+    CheckAllEnums<CardSet>(CARD_SET_STR);
+    CheckAllEnums<CardType>(CARD_TYPE_STR);
+    CheckAllEnums<Faction>(FACTION_STR);
+    CheckAllEnums<GameTag>(GAME_TAG_STR);
+    CheckAllEnums<PlayReq>(PLAY_REQ_STR);
+    CheckAllEnums<Race>(RACE_STR);
+    CheckAllEnums<Rarity>(RARITY_STR);
+
+    EXPECT_EQ(StrToEnum<GameTag>("TAUNT"), GameTag::TAUNT);
+    EXPECT_EQ(StrToEnum<GameTag>(""), GameTag::INVALID);
+    EXPECT_EQ(StrToEnum<GameTag>("TAUNT_"), GameTag::INVALID);
+    EXPECT_EQ(StrToEnum<Race>("taunt"), Race::INVALID);
+}
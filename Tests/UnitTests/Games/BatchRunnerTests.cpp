@@ -0,0 +1,85 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "gtest/gtest.h"
+
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/BatchRunner.hpp>
+#include <Rosetta/Policies/RandomPolicy.hpp>
+
+using namespace RosettaStone;
+
+TEST(BatchRunner, Run)
+{
+    GameConfig config;
+    config.player1Class = CardClass::ROGUE;
+    config.player2Class = CardClass::PALADIN;
+    config.startPlayer = PlayerType::RANDOM;
+    config.doShuffle = true;
+    config.doFillDecks = false;
+    config.skipMulligan = false;
+    config.autoRun = true;
+
+    std::array<std::string, START_DECK_SIZE> deck = {
+        "CS2_106", "CS2_105", "CS1_112", "CS1_112",  // 1
+        "CS1_113", "CS1_113", "CS1_130", "CS1_130",  // 2
+        "CS2_007", "CS2_007", "CS2_022", "CS2_022",  // 3
+        "CS2_023", "CS2_023", "CS2_024", "CS2_024",  // 4
+        "CS2_025", "CS2_025", "CS2_026", "CS2_026",  // 5
+        "CS2_027", "CS2_027", "CS2_029", "CS2_029",  // 6
+        "CS2_032", "CS2_032", "CS2_033", "CS2_033",  // 7
+        "CS2_037", "CS2_037"
+    };
+
+    for (std::size_t i = 0; i < START_DECK_SIZE; ++i)
+    {
+        config.player1Deck[i] = *Cards::GetInstance().FindCardByID(deck[i]);
+        config.player2Deck[i] = *Cards::GetInstance().FindCardByID(deck[i]);
+    }
+
+    const auto policyFactory = []() {
+        return std::unique_ptr<IPolicy>(new RandomPolicy());
+    };
+
+    std::vector<std::uint64_t> seeds;
+    std::vector<GameConfig> configs;
+    for (std::uint64_t seed = 0; seed < 20; ++seed)
+    {
+        seeds.emplace_back(seed);
+        configs.emplace_back(config);
+        configs.back().seed = seed;
+    }
+
+    const BatchRunner singleRunner(policyFactory, policyFactory, 1);
+    const BatchRunner multiRunner(policyFactory, policyFactory, 4);
+    EXPECT_EQ(singleRunner.GetNumThreads(), 1u);
+    EXPECT_EQ(multiRunner.GetNumThreads(), 4u);
+
+    const auto results1 = singleRunner.Run(config, seeds);
+    const auto results2 = multiRunner.Run(config, seeds);
+    const auto results3 = multiRunner.Run(configs);
+    EXPECT_EQ(results1.size(), seeds.size());
+    EXPECT_EQ(results2.size(), seeds.size());
+    EXPECT_EQ(results3.size(), seeds.size());
+
+    for (std::size_t i = 0; i < seeds.size(); ++i)
+    {
+        EXPECT_NE(results1[i].player1State, PlayState::PLAYING);
+        EXPECT_NE(results1[i].player2State, PlayState::PLAYING);
+        EXPECT_GT(results1[i].turns, 0);
+
+        EXPECT_EQ(results1[i].player1State, results2[i].player1State);
+        EXPECT_EQ(results1[i].player2State, results2[i].player2State);
+        EXPECT_EQ(results1[i].turns, results2[i].turns);
+
+        // The seeds in the game configs play the same games
+        EXPECT_EQ(results1[i].player1State, results3[i].player1State);
+        EXPECT_EQ(results1[i].player2State, results3[i].player2State);
+        EXPECT_EQ(results1[i].turns, results3[i].turns);
+    }
+
+    EXPECT_TRUE(multiRunner.Run(config, {}).empty());
+}
@@ -19,10 +19,6 @@
 #include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
 #include <Rosetta/Views/Board.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 using namespace RosettaStone;
 using namespace PlayerTasks;
 
@@ -60,8 +56,10 @@ class TestActionParams : public ActionParams
             }
         }
 
+        Random& random = m_board->GetCurrentPlayer().GetGame()->random;
+
         const std::size_t count = choices.Size();
-        const auto randIdx = Random::get<std::size_t>(0, count - 1);
+        const auto randIdx = random.Get<std::size_t>(0, count - 1);
         const int result = static_cast<int>(randIdx);
 
         return result;
@@ -102,6 +100,121 @@ TEST(Game, RefCopyFrom)
     delete game1;
 }
 
+TEST(Game, Clone)
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::SHAMAN;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.StartGame();
+    game.ProcessUntil(Step::MAIN_START);
+
+    Player& curPlayer = game.GetCurrentPlayer();
+    Player& opPlayer = game.GetOpponentPlayer();
+    curPlayer.SetTotalMana(10);
+    curPlayer.SetUsedMana(0);
+    opPlayer.SetTotalMana(10);
+    opPlayer.SetUsedMana(0);
+
+    auto& curField = curPlayer.GetFieldZone();
+
+    const auto card1 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Raid Leader"));
+    const auto card2 = Generic::DrawCard(
+        curPlayer, Cards::FindCardByName("Boulderfist Ogre"));
+
+    game.Process(curPlayer, PlayCardTask::Minion(card2));
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+    game.Process(curPlayer, EndTurnTask());
+    game.ProcessUntil(Step::MAIN_START);
+
+    auto clonedGame = game.Clone();
+    EXPECT_EQ(clonedGame->CreateView(), game.CreateView());
+    EXPECT_EQ(clonedGame->GetTurn(), game.GetTurn());
+    EXPECT_EQ(clonedGame->auras.size(), game.auras.size());
+
+    Player& clonedCurPlayer = clonedGame->GetCurrentPlayer();
+    Player& clonedOpPlayer = clonedGame->GetOpponentPlayer();
+    auto& clonedOpField = clonedOpPlayer.GetFieldZone();
+    EXPECT_EQ(clonedCurPlayer.playerType, opPlayer.playerType);
+    EXPECT_EQ(clonedOpPlayer.GetHero()->GetHealth(),
+              curPlayer.GetHero()->GetHealth());
+    EXPECT_EQ(clonedOpField.GetCount(), 2);
+    EXPECT_NE(clonedOpField[0], curField[0]);
+    EXPECT_EQ(clonedOpField[0]->owner, &clonedOpPlayer);
+    EXPECT_EQ(clonedOpField[0]->GetAttack(), 7);
+
+    const auto clonedCard1 = clonedOpField[1];
+    const auto clonedCard3 = Generic::DrawCard(
+        clonedCurPlayer, Cards::FindCardByName("Wolfrider"));
+    clonedGame->Process(clonedCurPlayer, PlayCardTask::Minion(clonedCard3));
+    clonedGame->Process(clonedCurPlayer, AttackTask(clonedCard3, clonedCard1));
+    EXPECT_EQ(clonedOpField.GetCount(), 1);
+    EXPECT_EQ(clonedOpField[0]->GetAttack(), 6);
+    EXPECT_EQ(curField.GetCount(), 2);
+    EXPECT_EQ(curField[0]->GetAttack(), 7);
+}
+
+TEST(Game, GetHash)
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::SHAMAN;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.StartGame();
+    game.ProcessUntil(Step::MAIN_START);
+
+    Player& curPlayer = game.GetCurrentPlayer();
+    curPlayer.SetTotalMana(10);
+    curPlayer.SetUsedMana(0);
+
+    const auto card1 = Generic::DrawCard(
+        curPlayer, Cards::FindCardByName("Boulderfist Ogre"));
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+
+    const std::uint64_t p1Hash = game.GetHash(PlayerType::PLAYER1);
+    const std::uint64_t p2Hash = game.GetHash(PlayerType::PLAYER2);
+    EXPECT_NE(p1Hash, p2Hash);
+
+    // Tag changes are reflected and reverted incrementally
+    auto minion = curPlayer.GetFieldZone()[0];
+    minion->SetDamage(2);
+    EXPECT_NE(game.GetHash(PlayerType::PLAYER1), p1Hash);
+    minion->SetDamage(0);
+    EXPECT_EQ(game.GetHash(PlayerType::PLAYER1), p1Hash);
+
+    // Game tags that the view can't see don't change the hash
+    const int entityID = minion->GetGameTag(GameTag::ENTITY_ID);
+    minion->SetGameTag(GameTag::ENTITY_ID, entityID + 100);
+    EXPECT_EQ(game.GetHash(PlayerType::PLAYER1), p1Hash);
+    minion->SetGameTag(GameTag::ENTITY_ID, entityID);
+
+    // Clones hash the same as the original
+    auto clonedGame1 = game.Clone();
+    auto clonedGame2 = game.Clone();
+    EXPECT_EQ(clonedGame1->GetHash(PlayerType::PLAYER1), p1Hash);
+    EXPECT_EQ(clonedGame1->GetHash(PlayerType::PLAYER2), p2Hash);
+
+    // Cards in the hand are only visible to their owner
+    Generic::DrawCard(clonedGame1->GetPlayer1(),
+                      Cards::FindCardByName("Wolfrider"));
+    Generic::DrawCard(clonedGame2->GetPlayer1(),
+                      Cards::FindCardByName("Raid Leader"));
+    EXPECT_NE(clonedGame1->GetHash(PlayerType::PLAYER1),
+              clonedGame2->GetHash(PlayerType::PLAYER1));
+    EXPECT_EQ(clonedGame1->GetHash(PlayerType::PLAYER2),
+              clonedGame2->GetHash(PlayerType::PLAYER2));
+    EXPECT_NE(clonedGame1->GetHash(PlayerType::PLAYER2), p2Hash);
+}
+
 TEST(Game, GetPlayer)
 {
     GameConfig config;
@@ -173,6 +286,55 @@ TEST(Game, Mulligan)
     GameManager::ProcessNextStep(game, game.nextStep);
 }
 
+TEST(Game, ProcessSteps)
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::ROGUE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = true;
+
+    Game game(config);
+    game.StartGame();
+
+    // The steps are processed until the game needs the input of player
+    EXPECT_EQ(game.step, Step::MAIN_ACTION);
+    EXPECT_EQ(game.nextStep, Step::MAIN_ACTION);
+    EXPECT_EQ(game.GetTurn(), 1);
+
+    // The task only moves the game to the end of the turn, and the steps of
+    // the next turn run after the task
+    EndTurnTask endTurnTask;
+    endTurnTask.SetPlayer(&game.GetCurrentPlayer());
+    endTurnTask.Run();
+    EXPECT_EQ(game.step, Step::MAIN_ACTION);
+    EXPECT_EQ(game.nextStep, Step::MAIN_END);
+    EXPECT_EQ(game.GetTurn(), 1);
+    game.nextStep = Step::MAIN_ACTION;
+
+    game.Process(game.GetCurrentPlayer(), EndTurnTask());
+    EXPECT_EQ(game.step, Step::MAIN_ACTION);
+    EXPECT_EQ(game.GetTurn(), 2);
+    EXPECT_EQ(&game.GetCurrentPlayer(), &game.GetPlayer2());
+
+    // Pause the game before the draw step and resume it
+    game.nextStep = Step::MAIN_END;
+    game.ProcessUntil(Step::MAIN_DRAW);
+    EXPECT_EQ(game.step, Step::MAIN_RESOURCE);
+    EXPECT_EQ(game.nextStep, Step::MAIN_DRAW);
+    EXPECT_EQ(game.GetTurn(), 3);
+
+    game.ProcessUntil(Step::MAIN_ACTION);
+    EXPECT_EQ(game.step, Step::MAIN_START);
+
+    // Auto run is disabled by ProcessUntil(), so only the next step runs
+    game.ProcessSteps();
+    EXPECT_EQ(game.step, Step::MAIN_ACTION);
+    game.ProcessSteps();
+    EXPECT_EQ(game.step, Step::MAIN_ACTION);
+}
+
 TEST(Game, GameOver_Player1Won)
 {
     GameConfig config;
@@ -331,11 +493,13 @@ TEST(Game, CreateView)
     game.ProcessUntil(Step::MAIN_START);
 
     const auto player1View = game.CreateView();
-    EXPECT_EQ(player1View.GetMyHeroPower().cardID, "CS2_102");
+    EXPECT_EQ(player1View.GetMyHeroPower().dbfID,
+              Cards::FindCardByID("CS2_102")->dbfID);
 
     game.Process(game.GetCurrentPlayer(), EndTurnTask());
     game.ProcessUntil(Step::MAIN_START);
 
     const auto player2View = game.CreateView();
-    EXPECT_EQ(player2View.GetMyHeroPower().cardID, "CS2_083b");
+    EXPECT_EQ(player2View.GetMyHeroPower().dbfID,
+              Cards::FindCardByID("CS2_083b")->dbfID);
 }
\ No newline at end of file
@@ -0,0 +1,168 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "gtest/gtest.h"
+
+#include <Rosetta/Loaders/CardLoader.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+using namespace RosettaStone;
+
+TEST(CardLoader, Binary)
+{
+    const std::string path = "CardLoaderTests.bin";
+
+    std::vector<Card*> jsonCards;
+    CardLoader::LoadFromJson(RESOURCES_DIR "cards.json", jsonCards);
+    CardLoader::SaveToBinary(path, RESOURCES_DIR "cards.json", jsonCards);
+
+    std::vector<Card*> binaryCards;
+    EXPECT_TRUE(CardLoader::LoadFromBinary(path, RESOURCES_DIR "cards.json",
+                                           binaryCards));
+    EXPECT_EQ(binaryCards.size(), jsonCards.size());
+
+    for (std::size_t i = 0; i < binaryCards.size(); ++i)
+    {
+        EXPECT_EQ(binaryCards[i]->id, jsonCards[i]->id);
+        EXPECT_EQ(binaryCards[i]->dbfID, jsonCards[i]->dbfID);
+        EXPECT_EQ(binaryCards[i]->name, jsonCards[i]->name);
+        EXPECT_EQ(binaryCards[i]->text, jsonCards[i]->text);
+        EXPECT_EQ(binaryCards[i]->gameTags, jsonCards[i]->gameTags);
+        EXPECT_EQ(binaryCards[i]->playRequirements,
+                  jsonCards[i]->playRequirements);
+        EXPECT_EQ(binaryCards[i]->entourages, jsonCards[i]->entourages);
+        EXPECT_EQ(binaryCards[i]->GetMaxAllowedInDeck(),
+                  jsonCards[i]->GetMaxAllowedInDeck());
+    }
+
+    for (Card* card : binaryCards)
+    {
+        delete card;
+    }
+    binaryCards.clear();
+
+    // Truncated data
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << "RSCD";
+    file.close();
+    EXPECT_FALSE(CardLoader::LoadFromBinary(path, RESOURCES_DIR "cards.json",
+                                            binaryCards));
+    EXPECT_TRUE(binaryCards.empty());
+
+    // Missing data
+    std::remove(path.c_str());
+    EXPECT_FALSE(CardLoader::LoadFromBinary(path, RESOURCES_DIR "cards.json",
+                                            binaryCards));
+
+    for (Card* card : jsonCards)
+    {
+        delete card;
+    }
+}
+
+TEST(CardLoader, StaleBinary)
+{
+    const std::string path = "CardLoaderTests_Stale.bin";
+    const std::string jsonPath = "CardLoaderTests_Stale.json";
+
+    {
+        std::ifstream src(RESOURCES_DIR "cards.json", std::ios::binary);
+        std::ofstream dst(jsonPath, std::ios::binary | std::ios::trunc);
+        dst << src.rdbuf();
+    }
+
+    std::vector<Card*> jsonCards;
+    CardLoader::LoadFromJson(jsonPath, jsonCards);
+    CardLoader::SaveToBinary(path, jsonPath, jsonCards);
+
+    std::vector<Card*> binaryCards;
+    EXPECT_TRUE(CardLoader::LoadFromBinary(path, jsonPath, binaryCards));
+    EXPECT_EQ(binaryCards.size(), jsonCards.size());
+
+    for (Card* card : binaryCards)
+    {
+        delete card;
+    }
+    binaryCards.clear();
+
+    // JSON file is edited after binary file is compiled
+    {
+        std::ofstream json(jsonPath, std::ios::binary | std::ios::app);
+        json << ' ';
+    }
+    EXPECT_FALSE(CardLoader::LoadFromBinary(path, jsonPath, binaryCards));
+    EXPECT_TRUE(binaryCards.empty());
+
+    // Binary file is used without JSON file
+    std::remove(jsonPath.c_str());
+    EXPECT_TRUE(CardLoader::LoadFromBinary(path, jsonPath, binaryCards));
+    EXPECT_EQ(binaryCards.size(), jsonCards.size());
+
+    for (Card* card : binaryCards)
+    {
+        delete card;
+    }
+
+    std::remove(path.c_str());
+
+    for (Card* card : jsonCards)
+    {
+        delete card;
+    }
+}
+
+TEST(CardLoader, OutOfRangeBinary)
+{
+    const std::string path = "CardLoaderTests_OutOfRange.bin";
+
+    std::vector<Card*> jsonCards;
+    CardLoader::LoadFromJson(RESOURCES_DIR "cards.json", jsonCards);
+    CardLoader::SaveToBinary(path, RESOURCES_DIR "cards.json", jsonCards);
+
+    const Card* card = jsonCards[0];
+    ASSERT_FALSE(card->gameTags.empty());
+
+    // Header: magic, version, the number of game tags and play requirements,
+    // the size and the modification time of JSON file and the number of cards
+    const std::size_t headerSize = 4 + 4 * 3 + 8 * 2 + 4;
+    const std::size_t gameTagPos = headerSize + 4 + card->id.size() + 4 + 4 +
+                                   card->name.size() + 4 + card->text.size() +
+                                   4;
+
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(gameTagPos));
+    const std::int32_t invalidTag = 1 << 20;
+    file.write(reinterpret_cast<const char*>(&invalidTag), sizeof(invalidTag));
+    file.close();
+
+    std::vector<Card*> binaryCards;
+    EXPECT_FALSE(CardLoader::LoadFromBinary(path, RESOURCES_DIR "cards.json",
+                                            binaryCards));
+    EXPECT_TRUE(binaryCards.empty());
+
+    // The number of cards that can't fit in the file
+    CardLoader::SaveToBinary(path, RESOURCES_DIR "cards.json", jsonCards);
+    file.open(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(headerSize - 4));
+    const std::int32_t invalidNumCards = 1 << 30;
+    file.write(reinterpret_cast<const char*>(&invalidNumCards),
+               sizeof(invalidNumCards));
+    file.close();
+
+    EXPECT_FALSE(CardLoader::LoadFromBinary(path, RESOURCES_DIR "cards.json",
+                                            binaryCards));
+    EXPECT_TRUE(binaryCards.empty());
+
+    std::remove(path.c_str());
+
+    for (Card* c : jsonCards)
+    {
+        delete c;
+    }
+}
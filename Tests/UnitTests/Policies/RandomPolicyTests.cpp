@@ -91,4 +91,55 @@ TEST(RandomPolicy, Mulligan)
 
         EXPECT_EQ(game.state, State::COMPLETE);
     }
-}
\ No newline at end of file
+}
+
+TEST(RandomPolicy, Seed)
+{
+    GameConfig config;
+    config.player1Class = CardClass::ROGUE;
+    config.player2Class = CardClass::PALADIN;
+    config.startPlayer = PlayerType::RANDOM;
+    config.doShuffle = true;
+    config.doFillDecks = false;
+    config.skipMulligan = false;
+    config.autoRun = true;
+    config.seed = 2019;
+
+    std::array<std::string, START_DECK_SIZE> deck = {
+        "CS2_106", "CS2_105", "CS1_112", "CS1_112",  // 1
+        "CS1_113", "CS1_113", "CS1_130", "CS1_130",  // 2
+        "CS2_007", "CS2_007", "CS2_022", "CS2_022",  // 3
+        "CS2_023", "CS2_023", "CS2_024", "CS2_024",  // 4
+        "CS2_025", "CS2_025", "CS2_026", "CS2_026",  // 5
+        "CS2_027", "CS2_027", "CS2_029", "CS2_029",  // 6
+        "CS2_032", "CS2_032", "CS2_033", "CS2_033",  // 7
+        "CS2_037", "CS2_037"
+    };
+
+    for (std::size_t i = 0; i < START_DECK_SIZE; ++i)
+    {
+        config.player1Deck[i] = *Cards::GetInstance().FindCardByID(deck[i]);
+        config.player2Deck[i] = *Cards::GetInstance().FindCardByID(deck[i]);
+    }
+
+    RandomPolicy policy;
+
+    Game game1(config);
+    game1.GetPlayer1().policy = &policy;
+    game1.GetPlayer2().policy = &policy;
+    game1.PlayPolicy();
+
+    Game game2(config);
+    game2.GetPlayer1().policy = &policy;
+    game2.GetPlayer2().policy = &policy;
+    game2.PlayPolicy();
+
+    EXPECT_EQ(game1.state, State::COMPLETE);
+    EXPECT_EQ(game1.GetTurn(), game2.GetTurn());
+    EXPECT_EQ(game1.GetPlayer1().playState, game2.GetPlayer1().playState);
+    EXPECT_EQ(game1.GetPlayer2().playState, game2.GetPlayer2().playState);
+    EXPECT_EQ(game1.GetPlayer1().GetHero()->GetHealth(),
+              game2.GetPlayer1().GetHero()->GetHealth());
+    EXPECT_EQ(game1.GetPlayer2().GetHero()->GetHealth(),
+              game2.GetPlayer2().GetHero()->GetHealth());
+}
@@ -0,0 +1,107 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "gtest/gtest.h"
+
+#include <Rosetta/Actions/Draw.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
+#include <Rosetta/Tasks/TaskProfiler.hpp>
+
+#include <json/json.hpp>
+
+#include <sstream>
+
+using namespace RosettaStone;
+using namespace PlayerTasks;
+
+TEST(TaskProfiler, RecordAndMerge)
+{
+    const Card* card = Cards::FindCardByID("CS2_029");
+
+    TaskProfiler profiler1;
+    profiler1.Record(TaskID::DAMAGE, card, std::chrono::nanoseconds(30), 2);
+    profiler1.Record(TaskID::DAMAGE, nullptr, std::chrono::nanoseconds(50),
+                     0);
+
+    TaskProfiler profiler2;
+    profiler2.Record(TaskID::DAMAGE, card, std::chrono::nanoseconds(40), 1);
+    profiler2.Record(TaskID::SUMMON, nullptr, std::chrono::nanoseconds(10),
+                     3);
+    profiler1.Merge(profiler2);
+
+    const TaskProfile damage = profiler1.GetTaskProfile(TaskID::DAMAGE);
+    EXPECT_EQ(damage.count, 3u);
+    EXPECT_EQ(damage.totalTime.count(), 120);
+    EXPECT_EQ(damage.maxTime.count(), 50);
+    EXPECT_EQ(damage.allocations, 3u);
+
+    EXPECT_EQ(profiler1.GetTaskProfile(TaskID::SUMMON).count, 1u);
+    EXPECT_EQ(profiler1.GetTaskProfile(TaskID::DRAW).count, 0u);
+
+    const auto& cardProfiles = profiler1.GetCardProfiles();
+    EXPECT_EQ(cardProfiles.size(), 1u);
+    EXPECT_EQ(cardProfiles.at("CS2_029").count, 2u);
+    EXPECT_EQ(cardProfiles.at("CS2_029").maxTime.count(), 40);
+
+    std::ostringstream csv;
+    profiler1.WriteCsv(csv);
+    EXPECT_EQ(csv.str(),
+              "type,key,count,totalTime,maxTime,allocations\n"
+              "task,DAMAGE,3,120,50,3\n"
+              "task,SUMMON,1,10,10,3\n"
+              "card,CS2_029,2,70,40,3\n");
+
+    std::ostringstream json;
+    profiler1.WriteJson(json);
+    const auto result = nlohmann::json::parse(json.str());
+    EXPECT_EQ(result["tasks"]["DAMAGE"]["count"], 3);
+    EXPECT_EQ(result["cards"]["CS2_029"]["totalTime"], 70);
+
+    profiler1.Clear();
+    EXPECT_EQ(profiler1.GetTaskProfile(TaskID::DAMAGE).count, 0u);
+    EXPECT_TRUE(profiler1.GetCardProfiles().empty());
+}
+
+TEST(TaskProfiler, Game)
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::ROGUE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.StartGame();
+    game.ProcessUntil(Step::MAIN_START);
+
+    Player& curPlayer = game.GetCurrentPlayer();
+    auto& opPlayer = game.GetOpponentPlayer();
+    curPlayer.SetTotalMana(10);
+    curPlayer.SetUsedMana(0);
+
+    const auto card = Generic::DrawCard(
+        curPlayer, Cards::FindCardByName("Fireball"));
+    game.Process(curPlayer,
+                 PlayCardTask::SpellTarget(card, opPlayer.GetHero()));
+    EXPECT_EQ(opPlayer.GetHero()->GetHealth(), 24);
+
+    const TaskProfiler& profiler = game.GetTaskProfiler();
+    const TaskProfile damage = profiler.GetTaskProfile(TaskID::DAMAGE);
+    if (TaskProfiler::IsEnabled())
+    {
+        EXPECT_EQ(damage.count, 1u);
+        EXPECT_EQ(profiler.GetCardProfiles().at("CS2_029").count, 1u);
+    }
+    else
+    {
+        EXPECT_EQ(damage.count, 0u);
+        EXPECT_TRUE(profiler.GetCardProfiles().empty());
+        EXPECT_EQ(TaskProfiler::GetNumAllocations(), 0u);
+    }
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "gtest/gtest.h"
+
+#include <Rosetta/Models/Player.hpp>
+#include <Rosetta/Tasks/TaskQueue.hpp>
+
+#include <functional>
+
+using namespace RosettaStone;
+
+class OrderTestTask : public ITask
+{
+ public:
+    OrderTestTask(std::vector<int>& order, int id,
+                  std::function<void()> callback = nullptr)
+        : m_order(order), m_id(id), m_callback(std::move(callback))
+    {
+        // Do nothing
+    }
+
+    TaskID GetTaskID() const override
+    {
+        return TaskID::INVALID;
+    }
+
+ private:
+    TaskStatus Impl(Player&) override
+    {
+        m_order.emplace_back(m_id);
+        if (m_callback)
+        {
+            m_callback();
+        }
+
+        return TaskStatus::COMPLETE;
+    }
+
+    ITask* CloneImpl(Arena* arena) override
+    {
+        return new (arena) OrderTestTask(m_order, m_id, m_callback);
+    }
+
+    std::vector<int>& m_order;
+    int m_id;
+    std::function<void()> m_callback;
+};
+
+TEST(TaskQueue, Events)
+{
+    Player player;
+    TaskQueue queue;
+    std::vector<int> order;
+
+    const auto enqueue = [&](int id, std::function<void()> callback) {
+        ITask* task = new OrderTestTask(order, id, std::move(callback));
+        task->SetPlayer(&player);
+        task->EnableFreeable();
+        queue.Enqueue(task);
+    };
+    const auto processAll = [&]() {
+        while (!queue.IsEmpty())
+        {
+            queue.Process();
+        }
+    };
+
+    enqueue(1, [&]() {
+        // The event processes its tasks before the rest of the outer queue
+        queue.StartEvent();
+        enqueue(10, [&]() {
+            queue.StartEvent();
+            enqueue(100, nullptr);
+            processAll();
+            queue.EndEvent();
+        });
+        enqueue(11, nullptr);
+        processAll();
+        queue.EndEvent();
+
+        // The event that enqueues nothing is empty
+        queue.StartEvent();
+        EXPECT_TRUE(queue.IsEmpty());
+        queue.EndEvent();
+    });
+    enqueue(2, nullptr);
+    enqueue(3, nullptr);
+
+    processAll();
+    EXPECT_EQ(order, std::vector<int>({ 1, 10, 100, 11, 2, 3 }));
+    EXPECT_TRUE(queue.IsEmpty());
+
+    // The queue is reused after it is emptied
+    order.clear();
+    enqueue(4, nullptr);
+    enqueue(5, nullptr);
+    processAll();
+    EXPECT_EQ(order, std::vector<int>({ 4, 5 }));
+}
@@ -7,6 +7,7 @@
 #include <Utils/TestUtils.hpp>
 #include "gtest/gtest.h"
 
+#include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Games/GameConfig.hpp>
 #include <Rosetta/Views/BoardRefView.hpp>
@@ -50,12 +51,14 @@ TEST(ReducedBoardView, All)
     {
         const auto id = static_cast<char>(i + 0x30);
         curCards.emplace_back(GenerateMinionCard(name + id, 1, 2));
+        curCards[i].dbfID = static_cast<int>(i) + 1;
         PlayMinionCard(curPlayer, &curCards[i]);
     }
     for (std::size_t i = 0; i < 3; ++i)
     {
         const auto id = static_cast<char>(i + 0x31);
         opCards.emplace_back(GenerateMinionCard(name + id, 3, 4));
+        opCards[i].dbfID = static_cast<int>(i) + 11;
         PlayMinionCard(opPlayer, &opCards[i]);
     }
 
@@ -69,26 +72,38 @@ TEST(ReducedBoardView, All)
     EXPECT_EQ(reducedBoard1.GetPlayerType(), PlayerType::PLAYER1);
 
     EXPECT_EQ(reducedBoard1.GetMyHero().attack, 3);
-    EXPECT_EQ(reducedBoard1.GetMyHeroPower().cardID, "CS2_102");
+    EXPECT_EQ(reducedBoard1.GetMyHeroPower().dbfID,
+              Cards::FindCardByID("CS2_102")->dbfID);
     EXPECT_EQ(reducedBoard1.GetMyWeapon().durability, 2);
     EXPECT_EQ(reducedBoard1.GetMyManaCrystal().total, 4);
     EXPECT_EQ(reducedBoard1.GetMyManaCrystal().remaining, 0);
     EXPECT_EQ(reducedBoard1.GetMyMinions().size(), 5);
-    EXPECT_EQ(reducedBoard1.GetMyMinions()[0].cardID, "test0");
+    EXPECT_EQ(reducedBoard1.GetMyMinions()[0].dbfID, 1);
     EXPECT_EQ(reducedBoard1.GetMyMinions()[0].attack, 1);
     EXPECT_EQ(reducedBoard1.GetMyMinions()[0].health, 2);
     EXPECT_EQ(reducedBoard1.GetMyHand().size(), 4u);
     EXPECT_EQ(reducedBoard1.GetMyDeck().count, 5);
 
     EXPECT_EQ(reducedBoard1.GetOpHero().attack, 4);
-    EXPECT_EQ(reducedBoard1.GetOpHeroPower().cardID, "CS2_083b");
+    EXPECT_EQ(reducedBoard1.GetOpHeroPower().dbfID,
+              Cards::FindCardByID("CS2_083b")->dbfID);
     EXPECT_EQ(reducedBoard1.GetOpWeapon().durability, 1);
     EXPECT_EQ(reducedBoard1.GetOpManaCrystal().total, 7);
     EXPECT_EQ(reducedBoard1.GetOpManaCrystal().remaining, 4);
     EXPECT_EQ(reducedBoard1.GetOpMinions().size(), 3);
-    EXPECT_EQ(reducedBoard1.GetOpMinions()[0].cardID, "test1");
+    EXPECT_EQ(reducedBoard1.GetOpMinions()[0].dbfID, 11);
     EXPECT_EQ(reducedBoard1.GetOpMinions()[0].attack, 3);
     EXPECT_EQ(reducedBoard1.GetOpMinions()[0].health, 4);
     EXPECT_EQ(reducedBoard1.GetOpHand().size(), 5u);
     EXPECT_EQ(reducedBoard1.GetOpDeck().count, 5);
+
+    curPlayer.GetFieldZone()[0]->SetDamage(1);
+    const ReducedBoardView reducedBoard3(board);
+    EXPECT_NE(reducedBoard1, reducedBoard3);
+    EXPECT_EQ(reducedBoard3.GetMyMinions()[0].health, 1);
+
+    const ReducedBoardView copiedBoard = reducedBoard1;
+    EXPECT_EQ(copiedBoard, reducedBoard1);
+    EXPECT_EQ(std::hash<ReducedBoardView>()(copiedBoard),
+              std::hash<ReducedBoardView>()(reducedBoard1));
 }
\ No newline at end of file
@@ -0,0 +1,51 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/TestUtils.hpp>
+#include "gtest/gtest.h"
+
+#include <Rosetta/Games/Game.hpp>
+
+using namespace RosettaStone;
+using namespace TestUtils;
+
+TEST(FieldZone, GetAlive)
+{
+    GameConfig config;
+    config.player1Class = CardClass::SHAMAN;
+    config.player2Class = CardClass::WARLOCK;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.StartGame();
+    game.ProcessUntil(Step::MAIN_START);
+
+    Player& curPlayer = game.GetCurrentPlayer();
+    curPlayer.SetTotalMana(10);
+    curPlayer.SetUsedMana(0);
+
+    auto& curField = curPlayer.GetFieldZone();
+
+    auto card1 = GenerateMinionCard("minion1", 1, 1);
+    PlayMinionCard(curPlayer, &card1);
+    PlayMinionCard(curPlayer, &card1);
+    PlayMinionCard(curPlayer, &card1);
+
+    curField[1]->Destroy();
+
+    std::vector<Minion*> minions;
+    for (auto& minion : curField.GetAlive())
+    {
+        minions.emplace_back(minion);
+    }
+
+    EXPECT_EQ(minions.size(), 2u);
+    EXPECT_EQ(minions[0], curField[0]);
+    EXPECT_EQ(minions[1], curField[2]);
+    EXPECT_EQ(minions, curField.GetAll());
+}